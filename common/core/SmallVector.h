@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Core::Utils
+{
+    /// @brief A vector that keeps up to N elements inline and only allocates once it grows past them.
+    /// @details Elements are stored contiguously either in the inline buffer or (after spilling) on the heap,
+    /// so index-based references stay valid across copies and moves. T must be default constructible.
+    template <typename T, size_t N> class SmallVector
+    {
+    public:
+        /// @brief Default Constructor
+        SmallVector() = default;
+
+        /// @brief Appends an element to the back of the vector.
+        /// @param value The element to be added.
+        void push_back(const T &value)
+        {
+            if (m_size == N && !m_spilled)
+            {
+                Spill(2 * N);
+            }
+
+            if (!m_spilled)
+            {
+                m_inline[m_size] = value;
+            }
+            else
+            {
+                m_heap.push_back(value);
+            }
+            ++m_size;
+        }
+
+        /// @brief Appends a range of elements to the back of the vector.
+        /// @param values Pointer to the first element to be added.
+        /// @param count The number of elements to add.
+        void append(const T *values, size_t count)
+        {
+            if (m_size + count > N && !m_spilled)
+            {
+                Spill(2 * (m_size + count));
+            }
+
+            if (!m_spilled)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    m_inline[m_size + i] = values[i];
+                }
+            }
+            else
+            {
+                m_heap.insert(m_heap.end(), values, values + count);
+            }
+            m_size += count;
+        }
+
+        /// @brief Removes all elements (and releases any heap storage).
+        void clear()
+        {
+            m_heap.clear();
+            m_heap.shrink_to_fit();
+            m_spilled = false;
+            m_size = 0;
+        }
+
+        /// @brief Gets a pointer to the first element.
+        T *data() { return m_spilled ? m_heap.data() : m_inline.data(); }
+
+        /// @brief Gets a pointer to the first element.
+        const T *data() const { return m_spilled ? m_heap.data() : m_inline.data(); }
+
+        /// @brief Gets the number of elements in the vector.
+        size_t size() const { return m_size; }
+
+        /// @brief Checks if the vector is empty.
+        bool empty() const { return m_size == 0; }
+
+        /// @brief Accesses an element by index (no bounds checking).
+        T &operator[](size_t index) { return data()[index]; }
+
+        /// @brief Accesses an element by index (no bounds checking).
+        const T &operator[](size_t index) const { return data()[index]; }
+
+        /// @brief Iterators over the stored elements.
+        T *begin() { return data(); }
+        T *end() { return data() + m_size; }
+        const T *begin() const { return data(); }
+        const T *end() const { return data() + m_size; }
+
+    private:
+        /// @brief Moves the inline elements to the heap.
+        /// @param capacity The heap capacity to reserve.
+        void Spill(size_t capacity)
+        {
+            m_heap.reserve(capacity);
+            m_heap.assign(m_inline.begin(), m_inline.begin() + m_size);
+            m_spilled = true;
+        }
+
+    private:
+        /// @brief Inline storage used until the vector grows past N elements.
+        std::array<T, N> m_inline{};
+
+        /// @brief Heap storage used once the vector has spilled (empty until then).
+        std::vector<T> m_heap;
+
+        /// @brief The number of elements currently stored.
+        size_t m_size = 0;
+
+        /// @brief Whether the elements have moved to the heap storage.
+        bool m_spilled = false;
+    };
+} // namespace Core::Utils
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <iostream>
+
+/// @brief Minimal helpers for the standalone test executables.
+/// @details Checks stay active in release builds (unlike assert) and keep running after a failure, so one run reports
+/// every broken expectation.
+namespace Test
+{
+    /// @brief The number of failed checks so far.
+    inline int failures = 0;
+
+    /// @brief Gets the exit code of the test executable.
+    inline int Result()
+    {
+        if (failures > 0)
+        {
+            std::cerr << failures << " check(s) failed." << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+} // namespace Test
+
+/// @brief Records a failure, with its location, if the condition does not hold.
+#define CHECK(condition)                                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(condition))                                                                                              \
+        {                                                                                                              \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl;                 \
+            ++Test::failures;                                                                                          \
+        }                                                                                                              \
+    } while (false)
@@ -0,0 +1,177 @@
+/// Tests for SmallVector and DiscordCommandParams (inline/heap storage, copies and moves).
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/core/SmallVector.h"
+#include "common/test.h"
+#include "server/core/CommandParams.h"
+
+using namespace Core::Utils;
+
+namespace
+{
+    /// @brief Checks whether a vector's elements live in its inline buffer rather than on the heap.
+    template <typename T, size_t N> bool IsInline(const SmallVector<T, N> &vector)
+    {
+        const auto *begin = reinterpret_cast<const char *>(&vector);
+        const auto *data = reinterpret_cast<const char *>(vector.data());
+        return data >= begin && data < begin + sizeof(vector);
+    }
+
+    /// @brief Checks that a vector holds 0, 1, 2, ... count - 1.
+    template <size_t N> bool HoldsSequence(const SmallVector<int, N> &vector, int count)
+    {
+        if (vector.size() != static_cast<size_t>(count))
+        {
+            return false;
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            if (vector[i] != i)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TestSmallVectorSpill()
+    {
+        SmallVector<int, 4> vector;
+        for (int i = 0; i < 4; ++i)
+        {
+            vector.push_back(i);
+        }
+        CHECK(IsInline(vector));
+        CHECK(HoldsSequence(vector, 4));
+
+        // The fifth element moves everything to the heap
+        vector.push_back(4);
+        CHECK(!IsInline(vector));
+        CHECK(HoldsSequence(vector, 5));
+
+        // Copies and moves keep the elements, whichever storage they are in
+        SmallVector<int, 4> copy = vector;
+        SmallVector<int, 4> moved = std::move(vector);
+        CHECK(HoldsSequence(copy, 5));
+        CHECK(HoldsSequence(moved, 5));
+
+        // Clearing goes back to inline storage
+        copy.clear();
+        copy.push_back(0);
+        CHECK(IsInline(copy));
+        CHECK(HoldsSequence(copy, 1));
+    }
+
+    void TestSmallVectorAppend()
+    {
+        const int values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        // A range that fits stays inline
+        SmallVector<int, 4> small;
+        small.append(values, 3);
+        CHECK(IsInline(small));
+        CHECK(HoldsSequence(small, 3));
+
+        // A range that crosses the inline capacity, starting from empty or partially filled
+        SmallVector<int, 4> fromEmpty;
+        fromEmpty.append(values, 10);
+        CHECK(!IsInline(fromEmpty));
+        CHECK(HoldsSequence(fromEmpty, 10));
+
+        small.append(values + 3, 7);
+        CHECK(!IsInline(small));
+        CHECK(HoldsSequence(small, 10));
+    }
+
+    void TestParamsValues()
+    {
+        const ParamId name = InternParam("test_name");
+        const ParamId amount = InternParam("test_amount");
+        const ParamId ratio = InternParam("test_ratio");
+        CHECK(InternParam("test_name") == name);
+        CHECK(ParamName(amount) == "test_amount");
+
+        DiscordCommandParams params;
+        params.set_string(name, "alice");
+        params.set_int(amount, 42);
+        params.set_double(ratio, 0.5);
+        CHECK(params.size() == 3);
+        CHECK(params.get_string(name) == std::string_view("alice"));
+        CHECK(params.get_int(amount) == 42);
+        CHECK(params.get_double(ratio) == 0.5);
+
+        // Lookups of the wrong type or of missing parameters fail instead of converting
+        CHECK(!params.get_int(name).has_value());
+        CHECK(!params.get_string(amount).has_value());
+        CHECK(!params.contains(InternParam("test_missing")));
+
+        // Setting a parameter again replaces its value
+        params.set_string(name, "bob");
+        CHECK(params.size() == 3);
+        CHECK(params.get_string(name) == std::string_view("bob"));
+    }
+
+    void TestParamsCopyAndMove(size_t num_params, size_t value_length)
+    {
+        std::vector<ParamId> ids;
+        for (size_t i = 0; i < num_params; ++i)
+        {
+            ids.push_back(InternParam("test_param_" + std::to_string(i)));
+        }
+        auto expected = [value_length](size_t i) { return std::string(value_length, static_cast<char>('a' + i)); };
+
+        DiscordCommandParams copy;
+        DiscordCommandParams moved;
+        {
+            DiscordCommandParams original;
+            for (size_t i = 0; i < num_params; ++i)
+            {
+                original.set_string(ids[i], expected(i));
+            }
+            copy = original;
+            moved = std::move(original);
+
+            // Overwrite what the original's storage held, so views left pointing into it would show up
+            original.clear();
+            for (size_t i = 0; i < num_params; ++i)
+            {
+                original.set_string(ids[i], std::string(value_length, '#'));
+            }
+        }
+
+        // The views must point into each container's own arena, not the (destroyed) original
+        for (size_t i = 0; i < num_params; ++i)
+        {
+            CHECK(copy.get_string(ids[i]) == std::string_view(expected(i)));
+            CHECK(moved.get_string(ids[i]) == std::string_view(expected(i)));
+        }
+
+        size_t visited = 0;
+        copy.for_each(
+            [&](ParamId id, const DiscordCommandParams::Value &value)
+            {
+                CHECK(id == ids[visited]);
+                CHECK(std::get<std::string_view>(value) == std::string_view(expected(visited)));
+                ++visited;
+            });
+        CHECK(visited == num_params);
+    }
+} // namespace
+
+int main()
+{
+    TestSmallVectorSpill();
+    TestSmallVectorAppend();
+    TestParamsValues();
+
+    // Entries and arena inline, entries spilled, arena spilled, and both spilled
+    TestParamsCopyAndMove(3, 8);
+    TestParamsCopyAndMove(10, 4);
+    TestParamsCopyAndMove(3, 100);
+    TestParamsCopyAndMove(10, 50);
+
+    return Test::Result();
+}
@@ -0,0 +1,344 @@
+/// Tests for OrderStatisticTree and LeaderboardIndex (ranks, eviction round trips, failed and concurrent loads).
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common/test.h"
+#include "server/ranking/LeaderboardIndex.h"
+#include "server/ranking/OrderStatisticTree.h"
+
+using namespace Core::Ranking;
+
+namespace
+{
+    /// @brief Reference ordering of the tree: descending score, then ascending player.
+    struct ByRank
+    {
+        bool operator()(const RankingEntry &a, const RankingEntry &b) const
+        {
+            return a.score != b.score ? a.score > b.score : a.player_id < b.player_id;
+        }
+    };
+
+    /// @brief Scores per player of a single guild and metric.
+    using ReferenceBoard = std::map<uint64_t, int64_t>;
+
+    /// @brief Checks a guild's board (and every player's rank in it) against the reference scores.
+    bool MatchesReference(LeaderboardIndex &index, uint64_t guild_id, RankingMetric metric,
+                          const ReferenceBoard &reference)
+    {
+        std::vector<RankingEntry> expected;
+        for (const auto &score : reference)
+        {
+            expected.push_back(RankingEntry{score.first, score.second});
+        }
+        std::sort(expected.begin(), expected.end(), ByRank());
+
+        std::vector<RankingEntry> top;
+        if (!index.TopK(guild_id, metric, expected.size() + 1, top) || top.size() != expected.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            std::optional<size_t> rank;
+            if (top[i].player_id != expected[i].player_id || top[i].score != expected[i].score ||
+                !index.RankOf(guild_id, metric, expected[i].player_id, rank) || rank != i + 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TestTreeAgainstReference()
+    {
+        std::mt19937 gen(7);
+        std::uniform_int_distribution<uint64_t> playerDist(1, 500);
+        std::uniform_int_distribution<int64_t> scoreDist(-50, 50);
+
+        OrderStatisticTree tree;
+        std::set<RankingEntry, ByRank> reference;
+        std::map<uint64_t, int64_t> scores;
+        for (int op = 0; op < 20000; ++op)
+        {
+            // Move a player to a new score, like Scoreboard::Add does
+            const uint64_t player = playerDist(gen);
+            auto it = scores.find(player);
+            if (it != scores.end())
+            {
+                CHECK(tree.Erase(RankingEntry{player, it->second}));
+                reference.erase(RankingEntry{player, it->second});
+            }
+            const int64_t score = scoreDist(gen);
+            scores[player] = score;
+            tree.Insert(RankingEntry{player, score});
+            reference.insert(RankingEntry{player, score});
+
+            // Erasing an entry that is not in the tree fails and leaves it untouched
+            CHECK(!tree.Erase(RankingEntry{player, score + 1000}));
+
+            if (op % 1000 == 0)
+            {
+                CHECK(tree.size() == reference.size());
+                size_t rank = 0;
+                for (const auto &entry : reference)
+                {
+                    CHECK(tree.RankOf(entry) == rank);
+                    CHECK(tree.At(rank).player_id == entry.player_id);
+                    ++rank;
+                }
+
+                std::vector<RankingEntry> top = tree.Top(10);
+                CHECK(top.size() == std::min<size_t>(10, reference.size()));
+                CHECK(std::equal(top.begin(), top.end(), reference.begin(),
+                                 [](const RankingEntry &a, const RankingEntry &b)
+                                 { return a.player_id == b.player_id && a.score == b.score; }));
+            }
+        }
+
+        tree.clear();
+        CHECK(tree.size() == 0);
+        CHECK(tree.Top(5).empty());
+    }
+
+    void TestEvictFreezeReload()
+    {
+        // Two resident guilds out of eight: every round trip evicts, freezes and reloads guilds
+        LeaderboardIndex index(2, std::chrono::hours(1));
+        std::map<uint64_t, ReferenceBoard> reference;
+        std::vector<RankingRecord> records;
+        for (uint64_t guild = 1; guild <= 8; ++guild)
+        {
+            for (uint64_t player = 1; player <= 5; ++player)
+            {
+                const int64_t score = static_cast<int64_t>(guild * 10 + player);
+                records.push_back(RankingRecord{guild, player, RankingMetric::COLLECTION_VALUE, score});
+                reference[guild][player] = score;
+            }
+        }
+        index.Rebuild(records);
+
+        std::mt19937 gen(11);
+        std::uniform_int_distribution<uint64_t> guildDist(1, 8);
+        std::uniform_int_distribution<uint64_t> playerDist(1, 8);
+        for (int round = 0; round < 2000; ++round)
+        {
+            const uint64_t guild = guildDist(gen);
+            const uint64_t player = playerDist(gen);
+            index.ApplyDelta(guild, player, RankingMetric::COLLECTION_VALUE, round % 7 - 3);
+            reference[guild][player] += round % 7 - 3;
+
+            if (round % 100 == 0)
+            {
+                CHECK(MatchesReference(index, guild, RankingMetric::COLLECTION_VALUE, reference[guild]));
+            }
+            CHECK(index.ResidentGuilds() <= 2);
+        }
+
+        int64_t total = 0;
+        for (const auto &guild : reference)
+        {
+            CHECK(MatchesReference(index, guild.first, RankingMetric::COLLECTION_VALUE, guild.second));
+            total += guild.second.at(1);
+        }
+
+        // Global scores are the sum over all guilds
+        int64_t globalScore = 0;
+        for (const auto &entry : index.GlobalTopK(RankingMetric::COLLECTION_VALUE, 100))
+        {
+            if (entry.player_id == 1)
+            {
+                globalScore = entry.score;
+            }
+        }
+        CHECK(globalScore == total);
+
+        // Unknown guilds have no scores, but are available
+        std::vector<RankingEntry> top;
+        CHECK(index.TopK(999, RankingMetric::COLLECTION_VALUE, 10, top) && top.empty());
+    }
+
+    void TestFrozenCap()
+    {
+        // A frozen record cap far below the data size: dropped guilds must be unavailable, never wrong
+        LeaderboardIndex index(2, std::chrono::seconds(0), nullptr, 50);
+        std::map<uint64_t, ReferenceBoard> reference;
+        std::mt19937 gen(3);
+        for (int i = 0; i < 20000; ++i)
+        {
+            const uint64_t guild = gen() % 20;
+            const uint64_t player = gen() % 10;
+            const int64_t delta = gen() % 100;
+            index.ApplyDelta(guild, player, RankingMetric::COLLECTION_VALUE, delta);
+            reference[guild][player] += delta;
+        }
+
+        size_t unavailable = 0;
+        std::vector<RankingRecord> records;
+        for (const auto &guild : reference)
+        {
+            std::vector<RankingEntry> top;
+            if (!index.TopK(guild.first, RankingMetric::COLLECTION_VALUE, 100, top))
+            {
+                ++unavailable;
+            }
+            else
+            {
+                CHECK(MatchesReference(index, guild.first, RankingMetric::COLLECTION_VALUE, guild.second));
+            }
+
+            for (const auto &score : guild.second)
+            {
+                records.push_back(
+                    RankingRecord{guild.first, score.first, RankingMetric::COLLECTION_VALUE, score.second});
+            }
+        }
+        CHECK(unavailable > 0);
+
+        // A rebuild from the database makes every guild available again (with a cap that fits the data)
+        LeaderboardIndex rebuilt(2, std::chrono::hours(1), nullptr, records.size());
+        rebuilt.Rebuild(records);
+        for (const auto &guild : reference)
+        {
+            CHECK(MatchesReference(rebuilt, guild.first, RankingMetric::COLLECTION_VALUE, guild.second));
+        }
+    }
+
+    void TestLoaderFailure()
+    {
+        std::atomic<bool> failing{true};
+        LeaderboardIndex index(4, std::chrono::hours(1),
+                               [&failing](uint64_t guild_id)
+                               {
+                                   if (failing)
+                                   {
+                                       throw std::runtime_error("database unavailable");
+                                   }
+                                   return std::vector<RankingRecord>{
+                                       RankingRecord{guild_id, 1, RankingMetric::RARITY_SCORE, 10}};
+                               });
+
+        // Queries report the rankings as unavailable instead of throwing, and updates still reach the global board
+        std::vector<RankingEntry> top;
+        std::optional<size_t> rank;
+        CHECK(!index.TopK(7, RankingMetric::RARITY_SCORE, 10, top));
+        CHECK(!index.RankOf(7, RankingMetric::RARITY_SCORE, 1, rank));
+        index.ApplyDelta(7, 2, RankingMetric::RARITY_SCORE, 5);
+        CHECK(index.GlobalRankOf(RankingMetric::RARITY_SCORE, 2) == 1);
+        CHECK(index.ResidentGuilds() == 0);
+        CHECK(RenderLeaderboard(index, 7, RankingMetric::RARITY_SCORE, false, 1, 10).find("unavailable") !=
+              std::string::npos);
+
+        // Once the database is back, the next query loads the guild
+        failing = false;
+        CHECK(index.TopK(7, RankingMetric::RARITY_SCORE, 10, top) && top.size() == 1 && top[0].score == 10);
+    }
+
+    /// @brief Runs writers and readers against an index, checking every guild against the reference afterwards.
+    /// @param with_loader Whether the index loads guilds from the reference "database" (or freezes them).
+    void TestConcurrent(bool with_loader)
+    {
+        constexpr uint64_t NUM_GUILDS = 8;
+        constexpr int NUM_WRITERS = 4;
+        constexpr int NUM_READERS = 2;
+        constexpr int DELTAS_PER_WRITER = 5000;
+
+        // The "database": mutations are committed and applied under one lock, so a loader snapshot never sees a
+        // mutation whose delta is applied after the snapshot
+        std::mutex databaseMutex;
+        std::map<uint64_t, ReferenceBoard> database;
+
+        LeaderboardIndex::GuildLoader loader = nullptr;
+        if (with_loader)
+        {
+            loader = [&](uint64_t guild_id)
+            {
+                std::vector<RankingRecord> records;
+                {
+                    std::lock_guard<std::mutex> lock(databaseMutex);
+                    for (const auto &score : database[guild_id])
+                    {
+                        records.push_back(
+                            RankingRecord{guild_id, score.first, RankingMetric::GAMBLING_WINNINGS, score.second});
+                    }
+                }
+
+                // Widen the window in which deltas are queued on the placeholder
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                return records;
+            };
+        }
+        LeaderboardIndex index(2, std::chrono::hours(1), loader);
+
+        std::vector<std::thread> threads;
+        for (int w = 0; w < NUM_WRITERS; ++w)
+        {
+            threads.emplace_back(
+                [&, w]
+                {
+                    std::mt19937 gen(100 + w);
+                    for (int i = 0; i < DELTAS_PER_WRITER; ++i)
+                    {
+                        const uint64_t guild = gen() % NUM_GUILDS;
+                        const uint64_t player = gen() % 20;
+                        const int64_t delta = static_cast<int64_t>(gen() % 21) - 10;
+                        std::lock_guard<std::mutex> lock(databaseMutex);
+                        database[guild][player] += delta;
+                        index.ApplyDelta(guild, player, RankingMetric::GAMBLING_WINNINGS, delta);
+                    }
+                });
+        }
+
+        std::atomic<bool> done{false};
+        for (int r = 0; r < NUM_READERS; ++r)
+        {
+            threads.emplace_back(
+                [&, r]
+                {
+                    std::mt19937 gen(200 + r);
+                    while (!done)
+                    {
+                        std::vector<RankingEntry> top;
+                        std::optional<size_t> rank;
+                        CHECK(index.TopK(gen() % NUM_GUILDS, RankingMetric::GAMBLING_WINNINGS, 5, top));
+                        CHECK(index.RankOf(gen() % NUM_GUILDS, RankingMetric::GAMBLING_WINNINGS, gen() % 20, rank));
+                    }
+                });
+        }
+
+        for (int w = 0; w < NUM_WRITERS; ++w)
+        {
+            threads[w].join();
+        }
+        done = true;
+        for (size_t t = NUM_WRITERS; t < threads.size(); ++t)
+        {
+            threads[t].join();
+        }
+
+        for (const auto &guild : database)
+        {
+            CHECK(MatchesReference(index, guild.first, RankingMetric::GAMBLING_WINNINGS, guild.second));
+        }
+    }
+} // namespace
+
+int main()
+{
+    TestTreeAgainstReference();
+    TestEvictFreezeReload();
+    TestFrozenCap();
+    TestLoaderFailure();
+    TestConcurrent(false);
+    TestConcurrent(true);
+
+    return Test::Result();
+}
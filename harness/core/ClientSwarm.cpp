@@ -0,0 +1,115 @@
+#include "harness/core/ClientSwarm.h"
+
+#include <cstring>
+#include <iostream>
+
+#include "quicknet/quicknet.h"
+
+namespace Harness
+{
+    namespace
+    {
+        /// @brief Marker identifying messages produced by the swarm.
+        constexpr uint32_t SWARM_MESSAGE_MAGIC = 0x484B4C47; // "HKLG"
+
+        /// @brief Size of a swarm message: the marker followed by the scheduled send time in steady clock ticks.
+        constexpr size_t SWARM_MESSAGE_SIZE = sizeof(uint32_t) + sizeof(int64_t);
+    } // namespace
+
+    ClientSwarm::ClientSwarm(std::string address, size_t num_clients, double messages_per_second)
+        : m_address(std::move(address)), m_numClients(num_clients), m_messagesPerSec(messages_per_second)
+    {
+    }
+
+    ClientSwarm::~ClientSwarm() { Stop(); }
+
+    void ClientSwarm::Start()
+    {
+        if (!m_done || m_numClients == 0)
+        {
+            return;
+        }
+
+        m_done = false;
+        m_sent = 0;
+        for (size_t i = 0; i < m_numClients; ++i)
+        {
+            m_clients.emplace_back(&ClientSwarm::ClientLoop, this, i);
+        }
+    }
+
+    void ClientSwarm::Stop()
+    {
+        m_done = true;
+        for (auto &client : m_clients)
+        {
+            if (client.joinable())
+            {
+                client.join();
+            }
+        }
+        m_clients.clear();
+    }
+
+    bool ClientSwarm::DecodeMessageLatency(const std::vector<uint8_t> &byteMsg,
+                                           std::chrono::steady_clock::duration &latency)
+    {
+        if (byteMsg.size() != SWARM_MESSAGE_SIZE)
+        {
+            return false;
+        }
+
+        uint32_t magic;
+        int64_t sentTicks;
+        std::memcpy(&magic, byteMsg.data(), sizeof(magic));
+        std::memcpy(&sentTicks, byteMsg.data() + sizeof(magic), sizeof(sentTicks));
+        if (magic != SWARM_MESSAGE_MAGIC)
+        {
+            return false;
+        }
+
+        auto sentAt = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(sentTicks));
+        latency = std::chrono::steady_clock::now() - sentAt;
+        return true;
+    }
+
+    void ClientSwarm::ClientLoop(size_t index)
+    {
+        QNET::Client client;
+        client.OnMessageReceived = [](const std::vector<uint8_t> &byteMsg) {};
+
+        if (!client.Connect(m_address.c_str()))
+        {
+            std::cerr << "Swarm client " << index << " failed to connect to " << m_address << std::endl;
+            return;
+        }
+
+        // Each client sends at an equal share of the aggregate rate, staggered so sends don't arrive in bursts
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(m_numClients) / m_messagesPerSec));
+        auto nextSend = std::chrono::steady_clock::now() + interval * index / m_numClients;
+
+        std::vector<uint8_t> byteMsg(SWARM_MESSAGE_SIZE);
+        std::memcpy(byteMsg.data(), &SWARM_MESSAGE_MAGIC, sizeof(SWARM_MESSAGE_MAGIC));
+
+        while (!m_done && client.IsConnected())
+        {
+            client.Poll();
+            client.ReceiveMessages();
+
+            // Send every message that fell due during the sleep, so the loop period does not cap the rate.
+            // Each one is stamped with its scheduled time, so time spent waiting here counts as latency.
+            const auto now = std::chrono::steady_clock::now();
+            while (now >= nextSend)
+            {
+                int64_t sentTicks = nextSend.time_since_epoch().count();
+                std::memcpy(byteMsg.data() + sizeof(SWARM_MESSAGE_MAGIC), &sentTicks, sizeof(sentTicks));
+                client.SendReliableMessageToServer(byteMsg);
+                m_sent.fetch_add(1, std::memory_order_relaxed);
+                nextSend += interval;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+    }
+} // namespace Harness
\ No newline at end of file
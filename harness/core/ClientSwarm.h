@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Harness
+{
+    /// @brief A group of QNET clients sending timestamped messages to the server at a fixed aggregate rate.
+    /// @details Every message carries its scheduled send time, so the server side (see DecodeMessageLatency) can
+    /// measure the client-to-ProcessMessage latency. Clients run in the same process, so both sides share the steady
+    /// clock.
+    class ClientSwarm
+    {
+    public:
+        /// @brief Constructs the swarm (clients are not connected until Start() is called).
+        /// @param address The server address to connect to (e.g. "127.0.0.1:9000").
+        /// @param num_clients The number of clients to connect.
+        /// @param messages_per_second The aggregate send rate across all clients.
+        ClientSwarm(std::string address, size_t num_clients, double messages_per_second);
+
+        /// @brief Destructor that stops and joins all clients.
+        ~ClientSwarm();
+
+        /// @brief Connects all clients and starts sending.
+        void Start();
+
+        /// @brief Stops sending and disconnects all clients.
+        void Stop();
+
+        /// @brief Gets the number of messages sent since Start().
+        /// @return The number of messages sent.
+        size_t sent() const { return m_sent.load(std::memory_order_relaxed); }
+
+        /// @brief Computes the latency of a message produced by the swarm.
+        /// @param byteMsg The message as received by the server.
+        /// @param[out] latency The time elapsed since the message was scheduled to be sent.
+        /// @return true if the message was produced by the swarm, false otherwise.
+        static bool DecodeMessageLatency(const std::vector<uint8_t> &byteMsg,
+                                         std::chrono::steady_clock::duration &latency);
+
+    private:
+        /// @brief The main loop for each client thread.
+        /// @param index The index of the client within the swarm (used to stagger sends).
+        void ClientLoop(size_t index);
+
+    private:
+        std::string m_address;   ///< @brief The server address to connect to.
+        size_t m_numClients;     ///< @brief The number of clients to connect.
+        double m_messagesPerSec; ///< @brief The aggregate send rate across all clients.
+
+        std::atomic<bool> m_done{true};     ///< @brief Atomic flag to signal client threads to shut down.
+        std::atomic<size_t> m_sent{0};      ///< @brief The number of messages sent since Start().
+        std::vector<std::thread> m_clients; ///< @brief One thread per connected client.
+    };
+} // namespace Harness
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "harness/core/EventSource.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include <dpp/json.h>
+
+namespace Harness
+{
+    namespace
+    {
+        /// @brief Reads a snowflake stored as a string field of a gateway object (0 if missing).
+        dpp::snowflake ReadSnowflake(const dpp::json &object, const char *field)
+        {
+            auto it = object.find(field);
+            if (it == object.end() || !it->is_string())
+            {
+                return dpp::snowflake(0);
+            }
+            return dpp::snowflake(std::stoull(it->get<std::string>()));
+        }
+
+        /// @brief Offset for synthetic ids, so they look like (and sort like) real snowflakes.
+        constexpr uint64_t SNOWFLAKE_BASE = 100'000'000'000'000'000ULL;
+
+        /// @brief Builds an INTERACTION_CREATE payload for an application command.
+        dpp::json MakeCommandPayload(size_t index, uint64_t guild_id, uint64_t user_id, const std::string &name,
+                                     dpp::json options)
+        {
+            dpp::json data = {{"id", std::to_string(5 * SNOWFLAKE_BASE)}, {"name", name}, {"type", 1}};
+            if (!options.empty())
+            {
+                data["options"] = std::move(options);
+            }
+
+            return {{"id", std::to_string(6 * SNOWFLAKE_BASE + index)},
+                    {"type", 2},
+                    {"token", "synthetic-" + std::to_string(index)},
+                    {"guild_id", std::to_string(guild_id)},
+                    {"member", {{"user", {{"id", std::to_string(user_id)}, {"username", "synthetic"}}}}},
+                    {"data", std::move(data)}};
+        }
+
+        /// @brief Builds a string option of an application command.
+        dpp::json MakeStringOption(const std::string &name, const std::string &value)
+        {
+            return {{"name", name}, {"type", 3}, {"value", value}};
+        }
+
+        /// @brief Converts a MESSAGE_REACTION_ADD payload into a reaction event.
+        Core::Discord::ReactionEvent ReadReaction(const dpp::json &d)
+        {
+            Core::Discord::ReactionEvent event;
+            event.message_id = ReadSnowflake(d, "message_id");
+            event.channel_id = ReadSnowflake(d, "channel_id");
+            event.guild_id = ReadSnowflake(d, "guild_id");
+            event.user_id = ReadSnowflake(d, "user_id");
+            if (d.contains("emoji"))
+            {
+                event.emoji = d["emoji"].value("name", "");
+            }
+            return event;
+        }
+    } // namespace
+
+    std::vector<HarnessEvent> LoadRecordedEvents(const std::string &filepath)
+    {
+        std::ifstream inputFileStream(filepath);
+        if (!inputFileStream.is_open())
+        {
+            throw std::runtime_error("Could not open file: " + filepath);
+        }
+
+        std::vector<HarnessEvent> events;
+        std::string line;
+        size_t lineNumber = 0;
+        while (std::getline(inputFileStream, line))
+        {
+            ++lineNumber;
+            if (line.empty())
+            {
+                continue;
+            }
+
+            try
+            {
+                dpp::json payload = dpp::json::parse(line);
+                const std::string type = payload.value("t", "");
+                dpp::json &d = payload.at("d");
+                if (type == "INTERACTION_CREATE")
+                {
+                    // Only application commands (type 2) are routed to OnSlashCommand
+                    if (d.value("type", 0) == dpp::it_application_command)
+                    {
+                        // Decode once up front so malformed interactions are rejected here, not mid-run
+                        dpp::interaction interaction;
+                        interaction.fill_from_json(&d);
+                        events.push_back({EventKind::INTERACTION_CREATE, d.dump()});
+                    }
+                }
+                else if (type == "MESSAGE_REACTION_ADD")
+                {
+                    ReadReaction(d);
+                    events.push_back({EventKind::MESSAGE_REACTION_ADD, d.dump()});
+                }
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << filepath << ":" << lineNumber << ": skipping malformed event (" << e.what() << ")"
+                          << std::endl;
+            }
+        }
+        return events;
+    }
+
+    std::vector<HarnessEvent> GenerateSyntheticEvents(size_t count, double reaction_ratio, uint32_t num_guilds,
+                                                      uint32_t num_users, uint32_t seed)
+    {
+        std::mt19937 gen(seed);
+        std::bernoulli_distribution isReaction(reaction_ratio);
+        std::bernoulli_distribution isPing(0.5);
+        std::bernoulli_distribution isGlobal(0.5);
+        std::uniform_int_distribution<uint64_t> guildDist(1, std::max<uint32_t>(num_guilds, 1));
+        std::uniform_int_distribution<uint64_t> userDist(1, std::max<uint32_t>(num_users, 1));
+        std::uniform_int_distribution<size_t> metricDist(0, 2);
+
+        const std::string metrics[] = {"value", "rarity", "gambling"};
+        const std::string scopes[] = {"server", "global"};
+
+        std::vector<HarnessEvent> events;
+        events.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint64_t guild = SNOWFLAKE_BASE + guildDist(gen);
+            const uint64_t user = 2 * SNOWFLAKE_BASE + userDist(gen);
+
+            if (isReaction(gen))
+            {
+                dpp::json d = {{"user_id", std::to_string(user)},
+                               {"channel_id", std::to_string(4 * SNOWFLAKE_BASE + guildDist(gen))},
+                               {"message_id", std::to_string(3 * SNOWFLAKE_BASE + i)},
+                               {"guild_id", std::to_string(guild)},
+                               {"emoji", {{"name", "\xE2\x9D\xA4"}}}}; // UTF-8 heart emoji
+                events.push_back({EventKind::MESSAGE_REACTION_ADD, d.dump()});
+            }
+            else if (isPing(gen))
+            {
+                dpp::json d = MakeCommandPayload(i, guild, user, "ping", dpp::json::array());
+                events.push_back({EventKind::INTERACTION_CREATE, d.dump()});
+            }
+            else
+            {
+                dpp::json options = dpp::json::array();
+                options.push_back(MakeStringOption("metric", metrics[metricDist(gen)]));
+                options.push_back(MakeStringOption("scope", scopes[isGlobal(gen) ? 1 : 0]));
+                dpp::json d = MakeCommandPayload(i, guild, user, "leaderboard", std::move(options));
+                events.push_back({EventKind::INTERACTION_CREATE, d.dump()});
+            }
+        }
+        return events;
+    }
+
+    void DispatchEvent(Core::Discord::Bot &bot, const HarnessEvent &event,
+                       std::chrono::steady_clock::time_point scheduled_at)
+    {
+        dpp::json d = dpp::json::parse(event.payload);
+        switch (event.kind)
+        {
+        case EventKind::INTERACTION_CREATE:
+        {
+            dpp::interaction interaction;
+            interaction.fill_from_json(&d);
+            bot.SubmitSlashCommand(interaction, scheduled_at);
+            break;
+        }
+        case EventKind::MESSAGE_REACTION_ADD:
+        {
+            Core::Discord::ReactionEvent reaction = ReadReaction(d);
+            reaction.received_at = scheduled_at;
+            bot.DispatchReaction(std::move(reaction));
+            break;
+        }
+        }
+    }
+} // namespace Harness
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "server/discord/Bot.h"
+
+namespace Harness
+{
+    /// @brief The gateway events the harness can inject.
+    enum class EventKind
+    {
+        INTERACTION_CREATE,   ///< An application command interaction.
+        MESSAGE_REACTION_ADD, ///< A reaction added to a message.
+    };
+
+    /// @brief A single gateway event that can be injected into the bot.
+    /// @details The payload is kept serialized and only decoded at dispatch time, like the gateway does, so payload
+    /// parsing and option conversion are part of the measured path.
+    struct HarnessEvent
+    {
+        EventKind kind;      ///< @brief The gateway event type.
+        std::string payload; ///< @brief The serialized gateway "d" object.
+    };
+
+    /// @brief Loads recorded gateway events from a file.
+    /// @details The file holds one gateway dispatch payload per line (e.g. `{"t":"INTERACTION_CREATE","d":{...}}`).
+    /// INTERACTION_CREATE application commands and MESSAGE_REACTION_ADD payloads are kept; other events are skipped,
+    /// and malformed lines are skipped with a warning.
+    /// @param filepath The relative or absolute path to the recording.
+    /// @return The recorded events in file order.
+    /// @throw std::runtime_error if the file cannot be opened.
+    std::vector<HarnessEvent> LoadRecordedEvents(const std::string &filepath);
+
+    /// @brief Generates synthetic events spread over a fixed population of guilds and users.
+    /// @details Slash commands are a mix of option-less and option-carrying commands.
+    /// @param count The number of events to generate.
+    /// @param reaction_ratio The fraction of events (0-1) that are reactions rather than slash commands.
+    /// @param num_guilds The number of distinct guilds events are spread over.
+    /// @param num_users The number of distinct users events are spread over.
+    /// @param seed The seed for the random number generator (same seed gives the same events).
+    /// @return The generated events.
+    std::vector<HarnessEvent> GenerateSyntheticEvents(size_t count, double reaction_ratio, uint32_t num_guilds,
+                                                      uint32_t num_users, uint32_t seed);
+
+    /// @brief Injects a single event into the bot as if it had arrived from the gateway.
+    /// @details Interactions are decoded with dpp and submitted through the same path as live slash commands.
+    /// @param bot The bot to dispatch the event through.
+    /// @param event The event to dispatch (left untouched, so recordings can be replayed repeatedly).
+    /// @param scheduled_at When the event was scheduled to arrive; its latency is measured from here, so generator
+    /// lag is not hidden (coordinated omission).
+    void DispatchEvent(Core::Discord::Bot &bot, const HarnessEvent &event,
+                       std::chrono::steady_clock::time_point scheduled_at);
+} // namespace Harness
\ No newline at end of file
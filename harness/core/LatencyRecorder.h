@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Harness
+{
+    /// @brief Summary statistics of a set of latency samples (all values in microseconds).
+    struct LatencySummary
+    {
+        size_t count = 0; ///< @brief The number of samples summarized.
+        double p50 = 0;   ///< @brief The median latency.
+        double p90 = 0;   ///< @brief The 90th percentile latency.
+        double p99 = 0;   ///< @brief The 99th percentile latency.
+        double p999 = 0;  ///< @brief The 99.9th percentile latency.
+        double max = 0;   ///< @brief The largest latency observed.
+    };
+
+    /// @brief Collects latency samples from many threads and summarizes them as percentiles.
+    class LatencyRecorder
+    {
+    public:
+        /// @brief Default Constructor
+        LatencyRecorder() = default;
+
+        /// @brief Records a single latency sample.
+        /// This operation is thread-safe.
+        /// @param latency The measured latency.
+        void record(std::chrono::steady_clock::duration latency)
+        {
+            int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_samples.push_back(micros);
+        }
+
+        /// @brief Gets the number of samples recorded since the last reset.
+        /// This operation is thread-safe.
+        /// @return The number of samples.
+        size_t count() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_samples.size();
+        }
+
+        /// @brief Discards all recorded samples.
+        /// This operation is thread-safe.
+        void reset()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_samples.clear();
+        }
+
+        /// @brief Computes percentiles over the recorded samples (nearest-rank method).
+        /// This operation is thread-safe.
+        /// @return The summary of all samples recorded since the last reset.
+        LatencySummary summarize() const
+        {
+            std::vector<int64_t> samples;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                samples = m_samples;
+            }
+
+            LatencySummary summary;
+            summary.count = samples.size();
+            if (samples.empty())
+            {
+                return summary;
+            }
+
+            std::sort(samples.begin(), samples.end());
+            auto percentile = [&samples](double p)
+            {
+                size_t rank = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+                return static_cast<double>(samples[rank]);
+            };
+
+            summary.p50 = percentile(0.50);
+            summary.p90 = percentile(0.90);
+            summary.p99 = percentile(0.99);
+            summary.p999 = percentile(0.999);
+            summary.max = static_cast<double>(samples.back());
+            return summary;
+        }
+
+    private:
+        /// @brief The recorded samples in microseconds.
+        std::vector<int64_t> m_samples;
+
+        /// @brief Mutex to protect access to the samples.
+        mutable std::mutex m_mutex;
+    };
+} // namespace Harness
\ No newline at end of file
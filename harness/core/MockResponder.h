@@ -0,0 +1,28 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "server/discord/Responder.h"
+
+namespace Harness
+{
+    /// @brief Responder standing in for dpp::cluster during offline runs.
+    /// @details Responses are counted and dropped instead of being sent to Discord.
+    class MockResponder : public Core::Discord::Responder
+    {
+    public:
+        /// @brief Records that a response was produced.
+        void EditInteractionResponse(const std::string &interaction_token, const dpp::message &response) override
+        {
+            m_responses.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// @brief Gets the number of responses produced so far.
+        /// @return The number of responses.
+        size_t responses() const { return m_responses.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<size_t> m_responses{0}; ///< @brief The number of responses produced so far.
+    };
+} // namespace Harness
\ No newline at end of file
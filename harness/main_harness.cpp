@@ -0,0 +1,320 @@
+#include "server/app/Application.h"
+
+#include "harness/core/ClientSwarm.h"
+#include "harness/core/EventSource.h"
+#include "harness/core/LatencyRecorder.h"
+#include "harness/core/MockResponder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    /// @brief Command line options of the harness.
+    struct HarnessConfig
+    {
+        std::vector<double> rates = {100, 1000, 5000}; ///< @brief Event rates (per second) to step through.
+        double duration = 10;                          ///< @brief Length of each rate step in seconds.
+        double drain_timeout = 5;                      ///< @brief Time to wait for queued tasks after a step.
+        size_t threads = 4;                            ///< @brief Number of task manager worker threads.
+        std::string replay_file;                       ///< @brief Recorded gateway events (synthetic if empty).
+        double reaction_ratio = 0.2;                   ///< @brief Fraction of synthetic events that are reactions.
+        uint32_t guilds = 50;                          ///< @brief Number of synthetic guilds.
+        uint32_t users = 5000;                         ///< @brief Number of synthetic users.
+        uint32_t seed = 1;                             ///< @brief Seed for synthetic event generation.
+        int32_t port = 9100;                           ///< @brief Port the offline server listens on.
+        size_t clients = 0;                            ///< @brief Number of QNET clients in the swarm.
+        double client_rate = 100;                      ///< @brief Aggregate swarm send rate (per second).
+        bool verbose = false;                          ///< @brief Keep the server's console output.
+    };
+
+    /// @brief Results of a single rate step.
+    struct StepResult
+    {
+        double offered_rate = 0;         ///< @brief The configured event rate.
+        size_t dispatched = 0;           ///< @brief Events injected into the bot.
+        size_t completed = 0;            ///< @brief Tasks processed before the drain timeout.
+        double throughput = 0;           ///< @brief Completed tasks per second over the step.
+        double max_lag_ms = 0;           ///< @brief Largest delay of the generator behind schedule.
+        Harness::LatencySummary discord; ///< @brief Event-to-task-completion latency.
+        size_t swarm_sent = 0;           ///< @brief Messages sent by the client swarm.
+        Harness::LatencySummary swarm;   ///< @brief Client-to-ProcessMessage latency.
+    };
+
+    void PrintUsage()
+    {
+        std::cerr << "Usage: server-harness [options]\n"
+                  << "  --rates <r1,r2,...>      event rates per second to step through (default 100,1000,5000)\n"
+                  << "  --duration <seconds>     length of each rate step (default 10)\n"
+                  << "  --drain-timeout <sec>    time to wait for queued tasks after each step (default 5)\n"
+                  << "  --threads <n>            task manager worker threads (default 4)\n"
+                  << "  --replay <file>          replay recorded gateway events (one JSON payload per line)\n"
+                  << "  --reaction-ratio <0-1>   fraction of synthetic events that are reactions (default 0.2)\n"
+                  << "  --guilds <n>             synthetic guild count (default 50)\n"
+                  << "  --users <n>              synthetic user count (default 5000)\n"
+                  << "  --seed <n>               synthetic event seed (default 1)\n"
+                  << "  --port <n>               port for the offline server (default 9100)\n"
+                  << "  --clients <n>            QNET clients in the swarm (default 0, disabled)\n"
+                  << "  --client-rate <r>        aggregate swarm messages per second (default 100)\n"
+                  << "  --verbose                keep the server's per-task console output\n";
+    }
+
+    /// @brief Parses the command line into a config.
+    /// @return false if the arguments are invalid.
+    bool ParseArguments(int argc, char **argv, HarnessConfig &config)
+    {
+        try
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                std::string arg = argv[i];
+                if (arg == "--verbose")
+                {
+                    config.verbose = true;
+                    continue;
+                }
+                if (i + 1 >= argc)
+                {
+                    std::cerr << "Missing value for " << arg << std::endl;
+                    return false;
+                }
+
+                std::string value = argv[++i];
+                if (arg == "--rates")
+                {
+                    config.rates.clear();
+                    std::stringstream ss(value);
+                    std::string rate;
+                    while (std::getline(ss, rate, ','))
+                    {
+                        config.rates.push_back(std::stod(rate));
+                    }
+                }
+                else if (arg == "--duration")
+                    config.duration = std::stod(value);
+                else if (arg == "--drain-timeout")
+                    config.drain_timeout = std::stod(value);
+                else if (arg == "--threads")
+                    config.threads = std::stoul(value);
+                else if (arg == "--replay")
+                    config.replay_file = value;
+                else if (arg == "--reaction-ratio")
+                    config.reaction_ratio = std::stod(value);
+                else if (arg == "--guilds")
+                    config.guilds = std::stoul(value);
+                else if (arg == "--users")
+                    config.users = std::stoul(value);
+                else if (arg == "--seed")
+                    config.seed = std::stoul(value);
+                else if (arg == "--port")
+                    config.port = std::stoi(value);
+                else if (arg == "--clients")
+                    config.clients = std::stoul(value);
+                else if (arg == "--client-rate")
+                    config.client_rate = std::stod(value);
+                else
+                {
+                    std::cerr << "Unknown option " << arg << std::endl;
+                    return false;
+                }
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Invalid argument: " << e.what() << std::endl;
+            return false;
+        }
+
+        for (double rate : config.rates)
+        {
+            if (rate <= 0)
+            {
+                std::cerr << "Rates must be positive." << std::endl;
+                return false;
+            }
+        }
+        return !config.rates.empty() && config.duration > 0 && config.threads > 0 && config.client_rate > 0;
+    }
+
+    void PrintStep(const StepResult &result)
+    {
+        auto ms = [](double micros) { return micros / 1000.0; };
+
+        std::cout << std::fixed << std::setprecision(2) << "rate " << std::setw(8) << result.offered_rate << "/s"
+                  << " | sent " << std::setw(8) << result.dispatched << " | done " << std::setw(8) << result.completed
+                  << " | " << std::setw(10) << result.throughput << "/s"
+                  << " | p50 " << ms(result.discord.p50) << " p90 " << ms(result.discord.p90) << " p99 "
+                  << ms(result.discord.p99) << " p99.9 " << ms(result.discord.p999) << " max " << ms(result.discord.max)
+                  << " ms | gen lag " << result.max_lag_ms << " ms" << std::endl;
+
+        if (result.swarm_sent > 0)
+        {
+            std::cout << "    swarm | sent " << result.swarm_sent << " | recv " << result.swarm.count << " | p50 "
+                      << ms(result.swarm.p50) << " p90 " << ms(result.swarm.p90) << " p99 " << ms(result.swarm.p99)
+                      << " p99.9 " << ms(result.swarm.p999) << " max " << ms(result.swarm.max) << " ms" << std::endl;
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    HarnessConfig config;
+    if (!ParseArguments(argc, argv, config))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    // Load (or generate) the events to inject
+    std::vector<Harness::HarnessEvent> events;
+    if (!config.replay_file.empty())
+    {
+        events = Harness::LoadRecordedEvents(config.replay_file);
+    }
+    else
+    {
+        events = Harness::GenerateSyntheticEvents(100'000, config.reaction_ratio, config.guilds, config.users,
+                                                  config.seed);
+    }
+    if (events.empty())
+    {
+        std::cerr << "No events to replay." << std::endl;
+        return 1;
+    }
+
+    // Latency is measured from each event's scheduled arrival to the end of Task::process(), so a generator that
+    // falls behind still charges its lag to the server (no coordinated omission).
+    // Only events scheduled during the current step are counted, so a saturated step cannot leak into the next one.
+    Harness::LatencyRecorder discordLatency;
+    Harness::LatencyRecorder swarmLatency;
+    std::atomic<size_t> completed{0};
+    std::atomic<size_t> totalCompleted{0};
+    std::atomic<std::chrono::steady_clock::rep> stepStartTicks{0};
+
+    auto taskManager = std::make_shared<Core::Utils::TaskManager>(
+        config.threads,
+        [&](const Core::Utils::Task &task)
+        {
+            if (task.created_at.time_since_epoch().count() >= stepStartTicks.load(std::memory_order_acquire))
+            {
+                discordLatency.record(std::chrono::steady_clock::now() - task.created_at);
+                completed.fetch_add(1, std::memory_order_relaxed);
+            }
+            totalCompleted.fetch_add(1, std::memory_order_release);
+        });
+    taskManager->SetTaskLogging(config.verbose);
+    auto responder = std::make_shared<Harness::MockResponder>();
+
+    Server::Application app;
+    app.InitializeOffline(config.port, responder, taskManager);
+    app.OnMessageProcessed = [&swarmLatency](HSteamNetConnection hConn, const std::vector<uint8_t> &byteMsg)
+    {
+        std::chrono::steady_clock::duration latency;
+        if (Harness::ClientSwarm::DecodeMessageLatency(byteMsg, latency))
+        {
+            swarmLatency.record(latency);
+        }
+    };
+    std::thread appThread(&Server::Application::Start, &app);
+
+    std::shared_ptr<Core::Discord::Bot> bot = app.GetDiscordManager();
+
+    std::vector<StepResult> results;
+    size_t totalDispatched = 0;
+    for (double rate : config.rates)
+    {
+        StepResult result;
+        result.offered_rate = rate;
+
+        // Let tasks left over from a saturated step finish before measuring the next one
+        while (totalCompleted.load(std::memory_order_acquire) < totalDispatched)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        discordLatency.reset();
+        swarmLatency.reset();
+        completed = 0;
+
+        Harness::ClientSwarm swarm("127.0.0.1:" + std::to_string(config.port), config.clients, config.client_rate);
+        swarm.Start();
+
+        // Open-loop injection: each event has a fixed schedule, so a slow server cannot slow down the generator
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / rate));
+        const auto start = std::chrono::steady_clock::now();
+        stepStartTicks.store(start.time_since_epoch().count(), std::memory_order_release);
+        const auto end = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                     std::chrono::duration<double>(config.duration));
+
+        std::chrono::steady_clock::duration maxLag{0};
+        for (size_t i = 0;; ++i)
+        {
+            auto scheduled = start + interval * static_cast<int64_t>(i);
+            if (scheduled >= end)
+            {
+                break;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (now < scheduled)
+            {
+                std::this_thread::sleep_until(scheduled);
+            }
+            else
+            {
+                maxLag = std::max(maxLag, now - scheduled);
+            }
+
+            Harness::DispatchEvent(*bot, events[i % events.size()], scheduled);
+            ++result.dispatched;
+            ++totalDispatched;
+        }
+
+        // Wait for the queues to drain (tasks still queued after the timeout count as not completed)
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                  std::chrono::duration<double>(config.drain_timeout));
+        while (completed < result.dispatched && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        swarm.Stop();
+
+        result.completed = completed;
+        result.throughput = static_cast<double>(result.completed) / elapsed.count();
+        result.max_lag_ms = std::chrono::duration<double, std::milli>(maxLag).count();
+        result.discord = discordLatency.summarize();
+        result.swarm_sent = swarm.sent();
+        result.swarm = swarmLatency.summarize();
+
+        PrintStep(result);
+        results.push_back(result);
+    }
+
+    // Saturation: the peak completion rate, and the highest offered rate that was still fully sustained
+    double peakThroughput = 0;
+    double sustainedRate = 0;
+    for (const auto &result : results)
+    {
+        peakThroughput = std::max(peakThroughput, result.throughput);
+        if (result.completed == result.dispatched && result.throughput >= 0.95 * result.offered_rate)
+        {
+            sustainedRate = std::max(sustainedRate, result.offered_rate);
+        }
+    }
+    std::cout << "saturation throughput " << peakThroughput << "/s | highest sustained rate " << sustainedRate
+              << "/s | responses sent " << responder->responses() << std::endl;
+
+    app.Shutdown();
+    appThread.join();
+
+    return 0;
+}
\ No newline at end of file
@@ -15,32 +15,74 @@ namespace Server
             std::cerr << "Failed to start task manager." << std::endl;
         }
 
+        // Instantiate Ranking Index
+        /// @todo Rebuild from the player collections (and pass a per-guild loader so idle guilds are dropped rather
+        /// than frozen) once inventories and balances are persisted through QuickDb. Until then idle guilds are
+        /// frozen in memory, bounded by the index's frozen record limit.
+        m_Rankings = std::make_shared<Core::Ranking::LeaderboardIndex>();
+        m_Rankings->Rebuild({});
+
         // Instantiate Server Connection
+        InitializeConnectionManager(server_port);
+
+        // Initiate Discord Bot
+        m_cluster = std::make_shared<dpp::cluster>(bot_token, dpp::i_default_intents | dpp::i_guild_messages);
+        m_DiscordManager = std::make_shared<Core::Discord::Bot>();
+        m_DiscordManager->Initialize(m_cluster, m_TaskManager, m_Rankings);
+
+        m_isRunning = true;
+    }
+
+    void Application::InitializeOffline(int32_t server_port, std::shared_ptr<Core::Discord::Responder> responder,
+                                        std::shared_ptr<Core::Utils::TaskManager> taskmanager)
+    {
+        m_TaskManager = std::move(taskmanager);
+        m_Rankings = std::make_shared<Core::Ranking::LeaderboardIndex>();
+
+        // Instantiate Server Connection
+        InitializeConnectionManager(server_port);
+
+        // Initiate Discord Bot (no gateway connection)
+        m_DiscordManager = std::make_shared<Core::Discord::Bot>();
+        m_DiscordManager->Initialize(std::move(responder), m_TaskManager, m_Rankings);
+
+        m_isRunning = true;
+    }
+
+    void Application::InitializeConnectionManager(int32_t server_port)
+    {
         m_ConnectionManager = std::make_shared<QNET::Server>();
-        if (m_ConnectionManager->Initialize(9000))
+        if (m_ConnectionManager->Initialize(server_port))
         {
             m_ConnectionManager->OnMessageReceived = [this](HSteamNetConnection hConn, const std::vector<uint8_t> &byteMsg)
-            { this->ProcessMessage(hConn, byteMsg); };
+            {
+                this->ProcessMessage(hConn, byteMsg);
+                if (this->OnMessageProcessed)
+                {
+                    this->OnMessageProcessed(hConn, byteMsg);
+                }
+            };
         }
         else
         {
             std::cerr << "Failed to start server." << std::endl;
         }
-
-        // Initiate Discord Bot
-        m_cluster = std::make_shared<dpp::cluster>(bot_token, dpp::i_default_intents | dpp::i_guild_messages);
-        m_DiscordManager = std::make_shared<Core::Discord::Bot>();
-        m_DiscordManager->Initialize(m_cluster, m_TaskManager);
-
-        m_isRunning = true;
     }
 
     void Application::Start()
     {
-        std::thread discordManagerThread(&Core::Discord::Bot::Run, m_DiscordManager);
+        // The bot only needs its own thread when connected to the gateway (not in offline mode)
+        std::thread discordManagerThread;
+        if (m_cluster)
+        {
+            discordManagerThread = std::thread(&Core::Discord::Bot::Run, m_DiscordManager);
+        }
         std::thread connectionManagerThread(&QNET::Server::Run, m_ConnectionManager);
 
-        discordManagerThread.join();
+        if (discordManagerThread.joinable())
+        {
+            discordManagerThread.join();
+        }
         connectionManagerThread.join();
     }
 
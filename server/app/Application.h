@@ -1,4 +1,6 @@
+#pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <thread>
@@ -10,6 +12,7 @@
 
 #include "server/core/TaskManager.h"
 #include "server/discord/Bot.h"
+#include "server/ranking/LeaderboardIndex.h"
 
 namespace Server
 {
@@ -30,6 +33,15 @@ namespace Server
         /// @param bot_token The authentication token for the Discord bot.
         void Initialize(int32_t server_port, const std::string &bot_token);
 
+        /// @brief Initializes the application without Discord or database connections.
+        /// @details The bot is set up in offline mode: events are injected through GetDiscordManager() and all
+        /// responses go to the given responder. Used by the offline load harness.
+        /// @param server_port The port number for the network server to listen on.
+        /// @param responder The responder that receives all outbound Discord responses.
+        /// @param taskmanager The task manager used to process submitted tasks.
+        void InitializeOffline(int32_t server_port, std::shared_ptr<Core::Discord::Responder> responder,
+                               std::shared_ptr<Core::Utils::TaskManager> taskmanager);
+
         /// @brief Starts the application main loop and all services.
         /// @details This is a blocking call that runs until Shutdown() is called.
         void Start();
@@ -37,9 +49,21 @@ namespace Server
         /// @brief Shuts down all services and cleans up resources.
         void Shutdown();
 
+        /// @brief Gets the Discord bot managed by this application.
+        /// @return A shared pointer to the bot.
+        std::shared_ptr<Core::Discord::Bot> GetDiscordManager() const { return m_DiscordManager; }
+
     public:
         void ProcessMessage(HSteamNetConnection hConn, const std::vector<uint8_t> &byteMsg);
 
+        /// @brief Optional callback invoked after ProcessMessage() has handled a client message.
+        std::function<void(HSteamNetConnection, const std::vector<uint8_t> &)> OnMessageProcessed;
+
+    private:
+        /// @brief Creates the network server and routes received messages to ProcessMessage().
+        /// @param server_port The port number for the network server to listen on.
+        void InitializeConnectionManager(int32_t server_port);
+
     private:
         bool m_isRunning = false; ///< @brief Flag indicating whether the application is currently running.
 
@@ -50,5 +74,7 @@ namespace Server
         std::shared_ptr<Core::Utils::TaskManager>
             m_TaskManager;                       ///< @brief Manages the thread pool for processing asynchronous tasks.
         std::shared_ptr<dpp::cluster> m_cluster; ///< @brief The dpp::cluster object for interacting with the Discord API.
+        std::shared_ptr<Core::Ranking::LeaderboardIndex>
+            m_Rankings; ///< @brief In-memory leaderboards, updated as inventories and balances change.
     };
 } // namespace Server
\ No newline at end of file
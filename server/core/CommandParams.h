@@ -0,0 +1,282 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "common/core/SmallVector.h"
+
+namespace Core::Utils
+{
+    /// @brief Interned identifier of a command parameter name.
+    using ParamId = uint16_t;
+
+    /// @brief Id returned when a parameter name could not be interned.
+    constexpr ParamId INVALID_PARAM_ID = UINT16_MAX;
+
+    /// @brief Maximum number of distinct parameter names that can be interned.
+    constexpr size_t MAX_INTERNED_PARAMS = 256;
+
+    /// @brief Process-wide table of interned parameter names.
+    /// @details Names are only ever appended, so readers scan the published prefix without locking; the mutex only
+    /// serializes writers. Command options are few and known per command, so the table stays small.
+    class ParamNameTable
+    {
+    public:
+        /// @brief Gets the process-wide table.
+        static ParamNameTable &Instance()
+        {
+            static ParamNameTable table;
+            return table;
+        }
+
+        /// @brief Gets the id of a parameter name, interning it if it has not been seen before.
+        /// @param name The parameter name.
+        /// @return The id of the name, or INVALID_PARAM_ID if the table is full (asserts in debug builds).
+        ParamId Intern(std::string_view name)
+        {
+            ParamId id = Find(name, m_count.load(std::memory_order_acquire));
+            if (id != INVALID_PARAM_ID)
+            {
+                return id;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            size_t count = m_count.load(std::memory_order_relaxed);
+            id = Find(name, count);
+            if (id != INVALID_PARAM_ID)
+            {
+                return id;
+            }
+            if (count == MAX_INTERNED_PARAMS)
+            {
+                // Only a handler interning unbounded names (e.g. user input) can get here
+                assert(false && "Parameter name table is full, raise MAX_INTERNED_PARAMS");
+                std::cerr << "Parameter table full, dropping parameter '" << name << "'." << std::endl;
+                return INVALID_PARAM_ID;
+            }
+
+            m_names[count] = std::string(name);
+            m_count.store(count + 1, std::memory_order_release);
+            return static_cast<ParamId>(count);
+        }
+
+        /// @brief Gets the name of an interned parameter.
+        /// @param id The parameter id.
+        /// @return The parameter name, or an empty view if the id is unknown.
+        std::string_view Name(ParamId id) const
+        {
+            return id < m_count.load(std::memory_order_acquire) ? std::string_view(m_names[id]) : std::string_view();
+        }
+
+    private:
+        /// @brief Searches the first 'count' published names.
+        ParamId Find(std::string_view name, size_t count) const
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (m_names[i] == name)
+                {
+                    return static_cast<ParamId>(i);
+                }
+            }
+            return INVALID_PARAM_ID;
+        }
+
+    private:
+        std::array<std::string, MAX_INTERNED_PARAMS> m_names; ///< @brief Interned names, indexed by id.
+        std::atomic<size_t> m_count{0};                       ///< @brief Number of published names.
+        std::mutex m_mutex;                                   ///< @brief Serializes interning of new names.
+    };
+
+    /// @brief Interns a parameter name (see ParamNameTable::Intern).
+    /// @details Command handlers should intern their parameter names once, e.g.
+    /// `static const ParamId AMOUNT = InternParam("amount");`, and look parameters up by id.
+    inline ParamId InternParam(std::string_view name) { return ParamNameTable::Instance().Intern(name); }
+
+    /// @brief Gets the name of an interned parameter (see ParamNameTable::Name).
+    inline std::string_view ParamName(ParamId id) { return ParamNameTable::Instance().Name(id); }
+
+    /// @brief Flat container for the parameters of a single command.
+    /// @details Parameters are stored as a small inline vector of (id, value) entries and looked up by a linear scan
+    /// over their interned ids. String values are copied into an arena owned by the container, so a command with a
+    /// handful of options needs no heap allocation at all. Strings are referenced by offset, which keeps the
+    /// container safe to copy and move.
+    class DiscordCommandParams
+    {
+    public:
+        /// @brief A parameter value; string views point into the container and live as long as it does.
+        using Value = std::variant<std::string_view, int64_t, double>;
+
+        /// @brief Default Constructor
+        DiscordCommandParams() = default;
+
+        /// @brief Sets an integer parameter (replacing any previous value).
+        void set_int(ParamId id, int64_t value) { Store(id, value); }
+
+        /// @brief Sets a floating point parameter (replacing any previous value).
+        void set_double(ParamId id, double value) { Store(id, value); }
+
+        /// @brief Sets a string parameter (replacing any previous value). The string is copied into the arena.
+        void set_string(ParamId id, std::string_view value)
+        {
+            StringRef ref{static_cast<uint32_t>(m_arena.size()), static_cast<uint32_t>(value.size())};
+            m_arena.append(value.data(), value.size());
+            Store(id, ref);
+        }
+
+        /// @brief Checks if a parameter was provided.
+        bool contains(ParamId id) const { return Find(id) != nullptr; }
+
+        /// @brief Gets a parameter value.
+        /// @return The value, or std::nullopt if the parameter was not provided.
+        std::optional<Value> get(ParamId id) const
+        {
+            const Entry *entry = Find(id);
+            if (!entry)
+            {
+                return std::nullopt;
+            }
+            return ToValue(*entry);
+        }
+
+        /// @brief Gets an integer parameter.
+        /// @return The value, or std::nullopt if the parameter is missing or not an integer.
+        std::optional<int64_t> get_int(ParamId id) const
+        {
+            const Entry *entry = Find(id);
+            if (!entry || !std::holds_alternative<int64_t>(entry->value))
+            {
+                return std::nullopt;
+            }
+            return std::get<int64_t>(entry->value);
+        }
+
+        /// @brief Gets a floating point parameter.
+        /// @return The value, or std::nullopt if the parameter is missing or not a number.
+        std::optional<double> get_double(ParamId id) const
+        {
+            const Entry *entry = Find(id);
+            if (!entry || !std::holds_alternative<double>(entry->value))
+            {
+                return std::nullopt;
+            }
+            return std::get<double>(entry->value);
+        }
+
+        /// @brief Gets a string parameter.
+        /// @return A view into the container, or std::nullopt if the parameter is missing or not a string.
+        std::optional<std::string_view> get_string(ParamId id) const
+        {
+            const Entry *entry = Find(id);
+            if (!entry || !std::holds_alternative<StringRef>(entry->value))
+            {
+                return std::nullopt;
+            }
+            return View(std::get<StringRef>(entry->value));
+        }
+
+        /// @brief Calls 'func(ParamId, Value)' for every parameter, in insertion order.
+        template <typename Func> void for_each(Func &&func) const
+        {
+            for (const Entry &entry : m_entries)
+            {
+                func(entry.id, ToValue(entry));
+            }
+        }
+
+        /// @brief Gets the number of parameters.
+        size_t size() const { return m_entries.size(); }
+
+        /// @brief Checks if no parameters were provided.
+        bool empty() const { return m_entries.empty(); }
+
+        /// @brief Removes all parameters.
+        void clear()
+        {
+            m_entries.clear();
+            m_arena.clear();
+        }
+
+    private:
+        /// @brief Location of a string value within the arena.
+        struct StringRef
+        {
+            uint32_t offset; ///< @brief Offset of the first character.
+            uint32_t length; ///< @brief Number of characters.
+        };
+
+        /// @brief A single parameter.
+        struct Entry
+        {
+            ParamId id = INVALID_PARAM_ID;                  ///< @brief The interned parameter name.
+            std::variant<StringRef, int64_t, double> value; ///< @brief The parameter value.
+        };
+
+        /// @brief Adds a parameter, or overwrites it if already present.
+        void Store(ParamId id, std::variant<StringRef, int64_t, double> value)
+        {
+            if (id == INVALID_PARAM_ID)
+            {
+                return;
+            }
+
+            for (Entry &entry : m_entries)
+            {
+                if (entry.id == id)
+                {
+                    entry.value = value;
+                    return;
+                }
+            }
+            m_entries.push_back(Entry{id, value});
+        }
+
+        /// @brief Finds the entry of a parameter.
+        const Entry *Find(ParamId id) const
+        {
+            for (const Entry &entry : m_entries)
+            {
+                if (entry.id == id)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        /// @brief Resolves a string reference into a view of the arena.
+        std::string_view View(StringRef ref) const { return std::string_view(m_arena.data() + ref.offset, ref.length); }
+
+        /// @brief Converts a stored entry to its public value.
+        Value ToValue(const Entry &entry) const
+        {
+            if (const auto *ref = std::get_if<StringRef>(&entry.value))
+            {
+                return View(*ref);
+            }
+            if (const auto *integer = std::get_if<int64_t>(&entry.value))
+            {
+                return *integer;
+            }
+            return std::get<double>(entry.value);
+        }
+
+    private:
+        /// @brief Inline capacity for parameters; commands rarely have more options than this.
+        static constexpr size_t INLINE_PARAMS = 6;
+
+        /// @brief Inline capacity of the string arena in bytes.
+        static constexpr size_t INLINE_ARENA_BYTES = 128;
+
+        SmallVector<Entry, INLINE_PARAMS> m_entries;   ///< @brief The parameters, in insertion order.
+        SmallVector<char, INLINE_ARENA_BYTES> m_arena; ///< @brief Storage for all string values.
+    };
+} // namespace Core::Utils
\ No newline at end of file
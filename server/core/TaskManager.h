@@ -1,11 +1,16 @@
 #pragma once
 
+#include <chrono>
 #include <dpp/dpp.h>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 
 #include "common/core/ThreadsafeQueue.h"
+#include "server/core/CommandParams.h"
+#include "server/discord/Responder.h"
+#include "server/ranking/LeaderboardIndex.h"
 
 namespace Core::Utils
 {
@@ -25,9 +30,6 @@ namespace Core::Utils
         DPP_REACTION_ADD,  ///< A Discord reaction add event task from DPP.
     };
 
-    /// @brief Abstraction over the Command Parameters - a map containing variant parameters indexed by param name
-    using DiscordCommandParams = std::map<std::string, std::variant<std::string, int64_t, double>>;
-
     /// @brief An abstract base class for a generic task.
     /// @details All specific task types must inherit from this class and implement the process method.
     class Task
@@ -42,6 +44,10 @@ namespace Core::Utils
     public:
         TaskPriority priority; ///< @brief The priority level of the task.
         TaskType type;         ///< @brief The specific type of the task.
+
+        /// @brief The time at which the originating event arrived (in the load harness: was scheduled to arrive).
+        /// @details Latency is measured from here, so time spent before the task was created is included.
+        std::chrono::steady_clock::time_point created_at = std::chrono::steady_clock::now();
     };
 
     /// @brief A task for processing a simple string message. (used as a test message)
@@ -52,7 +58,6 @@ namespace Core::Utils
         /// @brief Processes the message task by printing it to the console.
         void process() const override
         {
-            std::cout << "Processing task '" << int(priority) << "' on thread " << std::this_thread::get_id() << std::endl;
             std::cout << "Message: " << message << std::endl;
         }
 
@@ -66,23 +71,57 @@ namespace Core::Utils
         /// @brief Processes the slash command.
         void process() const override
         {
-            std::cout << "Processing task '" << int(priority) << "' on thread " << std::this_thread::get_id() << std::endl;
-
             if (command_name == "ping")
             {
                 dpp::message response;
                 response.set_content("Pong!");
-                bot_cluster->interaction_response_edit(interaction_token, response);
+                responder->EditInteractionResponse(interaction_token, response);
+            }
+            else if (command_name == "leaderboard" && rankings)
+            {
+                static const ParamId METRIC = InternParam("metric");
+                static const ParamId SCOPE = InternParam("scope");
+
+                dpp::message response;
+                auto metric = Ranking::ParseRankingMetric(parameters.get_string(METRIC).value_or("value"));
+                if (metric)
+                {
+                    const bool global = parameters.get_string(SCOPE).value_or("server") == "global";
+                    response.set_content(Ranking::RenderLeaderboard(*rankings, guild_id, *metric, global, user_id, 10));
+                }
+                else
+                {
+                    response.set_content("Unknown leaderboard.");
+                }
+                responder->EditInteractionResponse(interaction_token, response);
             }
         }
 
     public:
-        std::string interaction_token;             ///< @brief The interaction token for responding to the command.
-        std::string command_name;                  ///< @brief The name of the command that was invoked.
-        DiscordCommandParams parameters;           ///< @brief A map of parameters provided with the command.
-        dpp::snowflake guild_id;                   ///< @brief The ID of the guild where the command was used.
-        dpp::snowflake user_id;                    ///< @brief The ID of the user who invoked the command.
-        std::shared_ptr<dpp::cluster> bot_cluster; ///< @brief A shared pointer to the bot cluster to send responses.
+        std::string interaction_token;                 ///< @brief The interaction token for responding to the command.
+        std::string command_name;                      ///< @brief The name of the command that was invoked.
+        DiscordCommandParams parameters;               ///< @brief The parameters provided with the command.
+        dpp::snowflake guild_id;                       ///< @brief The ID of the guild where the command was used.
+        dpp::snowflake user_id;                        ///< @brief The ID of the user who invoked the command.
+        std::shared_ptr<Discord::Responder> responder; ///< @brief The responder used to send responses to Discord.
+        std::shared_ptr<Ranking::LeaderboardIndex>
+            rankings; ///< @brief The leaderboards used to answer ranking commands.
+    };
+
+    /// @brief A task for processing a reaction added to a message.
+    class TaskDiscordReaction : public Task
+    {
+        /// @brief Processes the reaction.
+        /// @todo No reaction handlers exist yet.
+        void process() const override {}
+
+    public:
+        std::string emoji;                             ///< @brief The name of the emoji that was added.
+        dpp::snowflake message_id;                     ///< @brief The ID of the message that was reacted to.
+        dpp::snowflake channel_id;                     ///< @brief The ID of the channel containing the message.
+        dpp::snowflake guild_id;                       ///< @brief The ID of the guild containing the message.
+        dpp::snowflake user_id;                        ///< @brief The ID of the user who added the reaction.
+        std::shared_ptr<Discord::Responder> responder; ///< @brief The responder used to send responses to Discord.
     };
 
     /// @brief Manages a pool of threads that process tasks from three priority
@@ -90,9 +129,14 @@ namespace Core::Utils
     class TaskManager
     {
     public:
+        /// @brief Callback invoked on the worker thread after a task has been processed.
+        using CompletionCallback = std::function<void(const Task &)>;
+
         /// @brief Constructs the TaskManager and starts the worker threads.
         /// @param num_threads The number of worker threads in the pool.
-        TaskManager(size_t num_threads) : m_done(false)
+        /// @param on_complete Optional callback invoked after every processed task (e.g. for latency tracking).
+        TaskManager(size_t num_threads, CompletionCallback on_complete = nullptr)
+            : m_done(false), m_onComplete(std::move(on_complete))
         {
             // Create and launch the specified number of worker threads
             for (size_t i = 0; i < num_threads; ++i)
@@ -116,6 +160,10 @@ namespace Core::Utils
             }
         }
 
+        /// @brief Enables or disables the per-task console log line (enabled by default).
+        /// @param enabled Whether workers log every task they process.
+        void SetTaskLogging(bool enabled) { m_logTasks = enabled; }
+
         /// @brief Submits a new task to the appropriate queue.
         /// @param task A unique_ptr to the task to be processed.
         void submit(std::unique_ptr<Task> task)
@@ -151,7 +199,26 @@ namespace Core::Utils
                 // Attempt to process tasks based on weighted priority
                 if (TryPopWeighted(task))
                 {
-                    task->process();
+                    if (m_logTasks)
+                    {
+                        std::cout << "Processing task '" << int(task->priority) << "' on thread "
+                                  << std::this_thread::get_id() << std::endl;
+                    }
+
+                    // A failing task must not take down the worker thread (and with it the process)
+                    try
+                    {
+                        task->process();
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::cerr << "Task '" << int(task->type) << "' failed: " << e.what() << std::endl;
+                    }
+
+                    if (m_onComplete)
+                    {
+                        m_onComplete(*task);
+                    }
                 }
                 else
                 {
@@ -195,6 +262,8 @@ namespace Core::Utils
         ThreadsafeQueue<std::unique_ptr<Task>> m_lowPriorityQueue;      ///< @brief Queue for low priority tasks.
 
         std::atomic<bool> m_done;           ///< @brief Atomic flag to signal worker threads to shut down.
+        std::atomic<bool> m_logTasks{true}; ///< @brief Whether workers log every task they process.
+        CompletionCallback m_onComplete;    ///< @brief Optional callback invoked after each processed task.
         std::vector<std::thread> m_workers; ///< @brief The pool of worker threads.
     };
 } // namespace Core::Utils
\ No newline at end of file
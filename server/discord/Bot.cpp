@@ -2,22 +2,121 @@
 
 #include "server/core/TaskManager.h"
 
+#include <type_traits>
+
 namespace Core::Discord
 {
+    namespace
+    {
+        /// @brief Stores a single command option value in a parameter container.
+        /// @details Snowflake options (users, channels, roles, attachments...) are stored as integers.
+        void SetCommandParameter(Utils::DiscordCommandParams &parameters, std::string_view name,
+                                 const dpp::command_value &value)
+        {
+            const Utils::ParamId id = Utils::InternParam(name);
+            std::visit(
+                [&parameters, id](const auto &value)
+                {
+                    using T = std::decay_t<decltype(value)>;
+                    if constexpr (std::is_same_v<T, std::string>)
+                        parameters.set_string(id, value);
+                    else if constexpr (std::is_same_v<T, int64_t>)
+                        parameters.set_int(id, value);
+                    else if constexpr (std::is_same_v<T, bool>)
+                        parameters.set_int(id, value ? 1 : 0);
+                    else if constexpr (std::is_same_v<T, dpp::snowflake>)
+                        parameters.set_int(id, static_cast<int64_t>(static_cast<uint64_t>(value)));
+                    else if constexpr (std::is_same_v<T, double>)
+                        parameters.set_double(id, value);
+                },
+                value);
+        }
+
+        /// @brief Copies the options of a command interaction straight into the task's parameter container.
+        /// @param options The options of the interaction (or of a subcommand).
+        /// @param[out] parameters The container to fill.
+        void FillParameters(const std::vector<dpp::command_data_option> &options,
+                            Utils::DiscordCommandParams &parameters)
+        {
+            for (const auto &option : options)
+            {
+                // Subcommands and groups carry nested options instead of a value
+                if (!option.options.empty())
+                {
+                    FillParameters(option.options, parameters);
+                    continue;
+                }
+
+                SetCommandParameter(parameters, option.name, option.value);
+            }
+        }
+    } // namespace
+
     void Bot::OnSlashCommand(const dpp::interaction_create_t &event)
     {
+        const auto receivedAt = std::chrono::steady_clock::now();
+
         /// @todo For now, going to keep this bot "thinking" event. If we expect some commands to quickly resolve,
         /// we can selectively choose to send this command.
         event.thinking();
 
+        SubmitSlashCommand(event.command, receivedAt);
+    }
+
+    void Bot::SubmitSlashCommand(const dpp::interaction &interaction, std::chrono::steady_clock::time_point received_at)
+    {
+        // Fill the task directly, so the parameters are written once into their final location
+        std::unique_ptr<Core::Utils::TaskDiscordCommand> task = CreateCommandTask();
+        task->created_at = received_at;
+        task->command_name = interaction.get_command_name();
+        task->guild_id = interaction.guild_id;
+        task->interaction_token = interaction.token;
+        task->user_id = interaction.get_issuing_user().id;
+
+        // Read the options in place (get_command_interaction() would copy the whole interaction data)
+        if (const auto *command = std::get_if<dpp::command_interaction>(&interaction.data))
+        {
+            FillParameters(command->options, task->parameters);
+        }
+
+        m_taskManager->submit(std::move(task));
+    }
+
+    void Bot::OnReactionAdd(const dpp::message_reaction_add_t &event)
+    {
+        ReactionEvent reaction;
+        reaction.emoji = event.reacting_emoji.name;
+        reaction.message_id = event.message_id;
+        reaction.channel_id = event.channel_id;
+        reaction.guild_id = event.reacting_member.guild_id;
+        reaction.user_id = event.reacting_user.id;
+        reaction.received_at = std::chrono::steady_clock::now();
+
+        DispatchReaction(std::move(reaction));
+    }
+
+    std::unique_ptr<Core::Utils::TaskDiscordCommand> Bot::CreateCommandTask() const
+    {
         std::unique_ptr<Core::Utils::TaskDiscordCommand> task = std::make_unique<Core::Utils::TaskDiscordCommand>();
         task->type = Core::Utils::TaskType::DPP_SLASH_COMMAND;
         task->priority = Core::Utils::TaskPriority::High;
-        task->bot_cluster = m_bot;
-        task->command_name = event.command.get_command_name();
-        task->guild_id = event.command.guild_id;
-        task->interaction_token = event.command.token;
-        task->user_id = event.command.get_issuing_user().id;
+        task->responder = m_responder;
+        task->rankings = m_rankings;
+        return task;
+    }
+
+    void Bot::DispatchReaction(ReactionEvent event)
+    {
+        std::unique_ptr<Core::Utils::TaskDiscordReaction> task = std::make_unique<Core::Utils::TaskDiscordReaction>();
+        task->type = Core::Utils::TaskType::DPP_REACTION_ADD;
+        task->priority = Core::Utils::TaskPriority::Standard;
+        task->created_at = event.received_at;
+        task->responder = m_responder;
+        task->emoji = std::move(event.emoji);
+        task->message_id = event.message_id;
+        task->channel_id = event.channel_id;
+        task->guild_id = event.guild_id;
+        task->user_id = event.user_id;
 
         m_taskManager->submit(std::move(task));
     }
@@ -1,12 +1,28 @@
 #pragma once
 
+#include <chrono>
 #include <dpp/dpp.h>
 #include <iostream>
 
 #include "server/core/TaskManager.h"
+#include "server/discord/Responder.h"
+#include "server/ranking/LeaderboardIndex.h"
 
 namespace Core::Discord
 {
+    /// @brief Transport-independent description of a reaction added to a message.
+    struct ReactionEvent
+    {
+        std::string emoji;         ///< @brief The name of the emoji that was added.
+        dpp::snowflake message_id; ///< @brief The ID of the message that was reacted to.
+        dpp::snowflake channel_id; ///< @brief The ID of the channel containing the message.
+        dpp::snowflake guild_id;   ///< @brief The ID of the guild containing the message.
+        dpp::snowflake user_id;    ///< @brief The ID of the user who added the reaction.
+
+        /// @brief When the event arrived (or was scheduled to arrive); latency is measured from here.
+        std::chrono::steady_clock::time_point received_at;
+    };
+
     /// @brief Manages the core functionality of the Discord bot.
     /// @details This class is responsible for initializing the bot, setting up event handlers,
     /// and starting the connection to Discord's gateway.
@@ -22,21 +38,47 @@ namespace Core::Discord
         /// @brief Initializes the bot and its event handlers.
         /// @param bot A shared pointer to the dpp::cluster instance.
         /// @param taskmanager A shared pointer to the TaskManager (Adding processing tasks to queue).
-        void Initialize(std::shared_ptr<dpp::cluster> &bot, std::shared_ptr<Utils::TaskManager> &taskmanager)
+        /// @param rankings A shared pointer to the leaderboards (Answering ranking commands).
+        void Initialize(std::shared_ptr<dpp::cluster> &bot, std::shared_ptr<Utils::TaskManager> &taskmanager,
+                        std::shared_ptr<Ranking::LeaderboardIndex> &rankings)
         {
             m_taskManager = taskmanager;
+            m_rankings = rankings;
             m_bot = bot;
+            m_responder = std::make_shared<ClusterResponder>(bot);
 
             // Setup event listeners
             m_bot->on_log(dpp::utility::cout_logger());
             m_bot->on_ready([this](const dpp::ready_t &event) { this->OnReady(event); });
             m_bot->on_slashcommand([this](const dpp::interaction_create_t &event) { this->OnSlashCommand(event); });
+            m_bot->on_message_reaction_add([this](const dpp::message_reaction_add_t &event)
+                                           { this->OnReactionAdd(event); });
+        }
+
+        /// @brief Initializes the bot without a gateway connection.
+        /// @details Events must be injected through SubmitSlashCommand() / DispatchReaction(); all responses are
+        /// sent to the given responder. Used by the offline load harness.
+        /// @param responder The responder that receives all outbound responses.
+        /// @param taskmanager A shared pointer to the TaskManager (Adding processing tasks to queue).
+        /// @param rankings A shared pointer to the leaderboards (Answering ranking commands).
+        void Initialize(std::shared_ptr<Responder> responder, std::shared_ptr<Utils::TaskManager> &taskmanager,
+                        std::shared_ptr<Ranking::LeaderboardIndex> &rankings)
+        {
+            m_taskManager = taskmanager;
+            m_rankings = rankings;
+            m_responder = std::move(responder);
         }
 
         /// @brief Starts the bot and connects to Discord.
         /// @details This is a blocking call that will run until the bot is shut down.
         void Run()
         {
+            if (!m_bot)
+            {
+                std::cerr << "Bot has no cluster (offline mode), not connecting." << std::endl;
+                return;
+            }
+
             std::cout << "Bot is starting..." << std::endl;
             m_bot->start(dpp::st_wait);
         };
@@ -53,12 +95,36 @@ namespace Core::Discord
         /// @param event The interaction create event data.
         void OnSlashCommand(const dpp::interaction_create_t &event);
 
+        /// @brief Handles reactions being added to messages.
+        /// @param event The reaction add event data.
+        void OnReactionAdd(const dpp::message_reaction_add_t &event);
+
+        /// @brief Converts a slash command interaction into a task and submits it to the task manager.
+        /// @details Used by OnSlashCommand() and by the offline harness, so replayed interactions take the live path.
+        /// @param interaction The application command interaction.
+        /// @param received_at When the interaction arrived (or was scheduled to arrive); latency is measured from here.
+        void SubmitSlashCommand(const dpp::interaction &interaction, std::chrono::steady_clock::time_point received_at);
+
+        /// @brief Converts a reaction into a task and submits it to the task manager.
+        /// @param event The reaction to process.
+        void DispatchReaction(ReactionEvent event);
+
     private:
-        /// @brief A shared pointer to the main dpp::cluster object.
+        /// @brief Creates a slash command task wired to this bot's responder and leaderboards.
+        std::unique_ptr<Utils::TaskDiscordCommand> CreateCommandTask() const;
+
+    private:
+        /// @brief A shared pointer to the main dpp::cluster object (null when running offline).
         std::shared_ptr<dpp::cluster> m_bot;
 
+        /// @brief The responder handed to tasks for sending responses back to Discord.
+        std::shared_ptr<Responder> m_responder;
+
         /// @brief A shared pointer to the task manager.
         /// Used to add tasks to the processing queue
         std::shared_ptr<Utils::TaskManager> m_taskManager;
+
+        /// @brief A shared pointer to the leaderboards, handed to tasks answering ranking commands.
+        std::shared_ptr<Ranking::LeaderboardIndex> m_rankings;
     };
 } // namespace Core::Discord
\ No newline at end of file
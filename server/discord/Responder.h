@@ -0,0 +1,41 @@
+#pragma once
+
+#include <dpp/dpp.h>
+#include <memory>
+#include <string>
+
+namespace Core::Discord
+{
+    /// @brief Abstraction over the outbound half of the Discord API used by tasks.
+    /// @details Tasks only ever need to send responses back to Discord; routing them through this interface lets
+    /// the same task code run against a live dpp::cluster or against an offline sink (e.g. the load harness).
+    class Responder
+    {
+    public:
+        /// @brief Virtual destructor to ensure proper cleanup of derived types.
+        virtual ~Responder() = default;
+
+        /// @brief Replaces the (deferred) response of an interaction.
+        /// @param interaction_token The interaction token of the command being answered.
+        /// @param response The message to display as the interaction response.
+        virtual void EditInteractionResponse(const std::string &interaction_token, const dpp::message &response) = 0;
+    };
+
+    /// @brief Responder that forwards all responses to a live dpp::cluster.
+    class ClusterResponder : public Responder
+    {
+    public:
+        /// @brief Constructs the responder around an existing cluster.
+        /// @param cluster A shared pointer to the dpp::cluster used to send responses.
+        explicit ClusterResponder(std::shared_ptr<dpp::cluster> cluster) : m_cluster(std::move(cluster)) {}
+
+        /// @brief Sends the response edit through the cluster's REST client.
+        void EditInteractionResponse(const std::string &interaction_token, const dpp::message &response) override
+        {
+            m_cluster->interaction_response_edit(interaction_token, response);
+        }
+
+    private:
+        std::shared_ptr<dpp::cluster> m_cluster; ///< @brief The cluster used to send responses.
+    };
+} // namespace Core::Discord
\ No newline at end of file
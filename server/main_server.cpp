@@ -3,14 +3,31 @@
 #include "common/core/FileReader.h"
 
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <thread>
 
-int main()
+int main(int argc, char **argv)
 {
     Server::Application app = Server::Application();
 
-    std::string botToken = Core::Utils::ReadFile("C:\\Users\\keblm\\Desktop\\Hakari\\bot_token.txt");
+    // The bot token is taken from HAKARI_BOT_TOKEN if set, otherwise read from the file given as the first
+    // argument (defaulting to 'bot_token.txt' in the working directory).
+    std::string botToken;
+    if (const char *envToken = std::getenv("HAKARI_BOT_TOKEN"))
+    {
+        botToken = envToken;
+    }
+    else
+    {
+        botToken = Core::Utils::ReadFile(argc > 1 ? argv[1] : "bot_token.txt");
+    }
+
+    // Strip trailing newlines left by editors when saving the token file
+    while (!botToken.empty() && (botToken.back() == '\n' || botToken.back() == '\r'))
+    {
+        botToken.pop_back();
+    }
 
     app.Initialize(9000, botToken);
     app.Start();
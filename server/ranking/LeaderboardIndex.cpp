@@ -0,0 +1,479 @@
+#include "server/ranking/LeaderboardIndex.h"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace Core::Ranking
+{
+    namespace
+    {
+        /// @brief How often queries and updates check for idle guilds.
+        constexpr std::chrono::steady_clock::duration SWEEP_INTERVAL = std::chrono::minutes(1);
+
+        /// @brief Static map for converting command parameter values to metrics.
+        const std::map<std::string, RankingMetric, std::less<>> METRIC_NAMES = {
+            {"value", RankingMetric::COLLECTION_VALUE},
+            {"rarity", RankingMetric::RARITY_SCORE},
+            {"gambling", RankingMetric::GAMBLING_WINNINGS}};
+    } // namespace
+
+    std::optional<RankingMetric> ParseRankingMetric(std::string_view name)
+    {
+        auto it = METRIC_NAMES.find(name);
+        if (it != METRIC_NAMES.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    std::string RankingMetricName(RankingMetric metric)
+    {
+        switch (metric)
+        {
+        case RankingMetric::COLLECTION_VALUE:
+            return "Collection Value";
+        case RankingMetric::RARITY_SCORE:
+            return "Rarest Cards";
+        case RankingMetric::GAMBLING_WINNINGS:
+            return "Gambling Winnings";
+        default:
+            return "Unknown";
+        }
+    }
+
+    void Scoreboard::Add(uint64_t player_id, int64_t delta)
+    {
+        auto it = m_scores.find(player_id);
+        if (it != m_scores.end())
+        {
+            m_tree.Erase(RankingEntry{player_id, it->second});
+            it->second += delta;
+        }
+        else
+        {
+            it = m_scores.emplace(player_id, delta).first;
+        }
+        m_tree.Insert(RankingEntry{player_id, it->second});
+    }
+
+    std::optional<size_t> Scoreboard::RankOf(uint64_t player_id) const
+    {
+        auto it = m_scores.find(player_id);
+        if (it == m_scores.end())
+        {
+            return std::nullopt;
+        }
+        return m_tree.RankOf(RankingEntry{player_id, it->second}) + 1;
+    }
+
+    int64_t Scoreboard::ScoreOf(uint64_t player_id) const
+    {
+        auto it = m_scores.find(player_id);
+        return it != m_scores.end() ? it->second : 0;
+    }
+
+    LeaderboardIndex::LeaderboardIndex(size_t max_resident_guilds, std::chrono::steady_clock::duration idle_timeout,
+                                       GuildLoader loader, size_t max_frozen_records)
+        : m_maxResidentGuilds(std::max<size_t>(max_resident_guilds, 1)), m_idleTimeout(idle_timeout),
+          m_loader(std::move(loader)), m_maxFrozenRecords(max_frozen_records),
+          m_lastSweep(std::chrono::steady_clock::now())
+    {
+    }
+
+    void LeaderboardIndex::Rebuild(const std::vector<RankingRecord> &records)
+    {
+        // Guild rankings are built lazily on first use; only the global rankings are built up front
+        std::unordered_map<uint64_t, FrozenGuild> byGuild;
+        {
+            std::lock_guard<std::mutex> lock(m_global.mutex);
+            for (auto &board : m_global.boards)
+            {
+                board = Scoreboard();
+            }
+            for (const auto &record : records)
+            {
+                Board(m_global.boards, record.metric).Add(record.player_id, record.score);
+                if (!m_loader)
+                {
+                    byGuild[record.guild_id].records.push_back(record);
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_guildsMutex);
+        for (const auto &guild : m_guilds)
+        {
+            std::lock_guard<std::mutex> guildLock(guild.second->mutex);
+            guild.second->evicted = true;
+        }
+        m_guilds.clear();
+
+        const auto now = std::chrono::steady_clock::now();
+        m_frozen = std::move(byGuild);
+        m_frozenRecords = 0;
+        m_dropped.clear();
+        for (auto &frozen : m_frozen)
+        {
+            frozen.second.frozen_at = now;
+            m_frozenRecords += frozen.second.records.size();
+        }
+        TrimFrozenLocked();
+    }
+
+    void LeaderboardIndex::ApplyDelta(uint64_t guild_id, uint64_t player_id, RankingMetric metric, int64_t delta)
+    {
+        // Dropped guilds and failed loads are skipped: the database holds the delta for the next load (with a
+        // loader), or the guild's rankings stay unavailable until the next Rebuild() (without one)
+        bool available = true;
+        while (std::shared_ptr<GuildRankings> guild = Acquire(guild_id, true, available))
+        {
+            std::lock_guard<std::mutex> lock(guild->mutex);
+            if (guild->failed)
+            {
+                break;
+            }
+            if (guild->evicted)
+            {
+                continue;
+            }
+
+            if (guild->loading)
+            {
+                guild->pending.push_back(PendingDelta{player_id, metric, delta});
+            }
+            else
+            {
+                Board(guild->boards, metric).Add(player_id, delta);
+            }
+            break;
+        }
+
+        // The global rankings are updated once the guild step is done, so both always see the same deltas
+        std::lock_guard<std::mutex> lock(m_global.mutex);
+        Board(m_global.boards, metric).Add(player_id, delta);
+    }
+
+    bool LeaderboardIndex::TopK(uint64_t guild_id, RankingMetric metric, size_t k, std::vector<RankingEntry> &top)
+    {
+        top.clear();
+        return Read(guild_id, [&](const GuildRankings &guild) { top = Board(guild.boards, metric).Top(k); });
+    }
+
+    bool LeaderboardIndex::RankOf(uint64_t guild_id, RankingMetric metric, uint64_t player_id,
+                                  std::optional<size_t> &rank)
+    {
+        rank.reset();
+        return Read(guild_id,
+                    [&](const GuildRankings &guild) { rank = Board(guild.boards, metric).RankOf(player_id); });
+    }
+
+    std::vector<RankingEntry> LeaderboardIndex::GlobalTopK(RankingMetric metric, size_t k) const
+    {
+        std::lock_guard<std::mutex> lock(m_global.mutex);
+        return Board(m_global.boards, metric).Top(k);
+    }
+
+    std::optional<size_t> LeaderboardIndex::GlobalRankOf(RankingMetric metric, uint64_t player_id) const
+    {
+        std::lock_guard<std::mutex> lock(m_global.mutex);
+        return Board(m_global.boards, metric).RankOf(player_id);
+    }
+
+    size_t LeaderboardIndex::ResidentGuilds() const
+    {
+        std::lock_guard<std::mutex> lock(m_guildsMutex);
+        return m_guilds.size();
+    }
+
+    std::shared_ptr<LeaderboardIndex::GuildRankings> LeaderboardIndex::Acquire(uint64_t guild_id, bool for_update,
+                                                                               bool &available)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        std::shared_ptr<GuildRankings> guild;
+        std::vector<RankingRecord> frozenRecords;
+        bool fromFrozen = false;
+        {
+            std::lock_guard<std::mutex> lock(m_guildsMutex);
+            if (now - m_lastSweep >= SWEEP_INTERVAL)
+            {
+                EvictLocked(now);
+            }
+
+            auto it = m_guilds.find(guild_id);
+            if (it != m_guilds.end())
+            {
+                it->second->last_used = now;
+                return it->second;
+            }
+
+            if (m_dropped.count(guild_id) != 0)
+            {
+                available = false;
+                return nullptr;
+            }
+
+            auto frozen = m_frozen.find(guild_id);
+            if (frozen != m_frozen.end())
+            {
+                frozenRecords = std::move(frozen->second.records);
+                m_frozenRecords -= frozenRecords.size();
+                m_frozen.erase(frozen);
+                fromFrozen = true;
+            }
+            else if (m_loader ? for_update : !for_update)
+            {
+                // With a loader the database already holds the delta; without one an unknown guild has no scores
+                return nullptr;
+            }
+
+            guild = std::make_shared<GuildRankings>();
+            guild->last_used = now;
+            guild->loading = fromFrozen || m_loader;
+            m_guilds.emplace(guild_id, guild);
+            EvictLocked(now);
+        }
+
+        // Build outside the index-wide lock so a large guild doesn't stall queries on every other guild
+        if (guild->loading)
+        {
+            Load(guild_id, guild, fromFrozen ? &frozenRecords : nullptr);
+        }
+        return guild;
+    }
+
+    void LeaderboardIndex::Load(uint64_t guild_id, const std::shared_ptr<GuildRankings> &guild,
+                                std::vector<RankingRecord> *records)
+    {
+        Boards boards;
+        bool failed = true;
+        std::string error = "unknown error";
+        try
+        {
+            std::vector<RankingRecord> loaded = records ? std::move(*records) : m_loader(guild_id);
+            for (const auto &record : loaded)
+            {
+                Board(boards, record.metric).Add(record.player_id, record.score);
+            }
+            failed = false;
+        }
+        catch (const std::exception &e)
+        {
+            error = e.what();
+        }
+        catch (...)
+        {
+            // Keeps the generic error message
+        }
+
+        if (failed)
+        {
+            std::cerr << "Could not load the rankings of guild " << guild_id << ": " << error << std::endl;
+
+            // Drop the placeholder so the next access loads again (with a loader), or remember the guild as dropped
+            // since its frozen records are gone (without one)
+            {
+                std::lock_guard<std::mutex> lock(m_guildsMutex);
+                auto it = m_guilds.find(guild_id);
+                if (it != m_guilds.end() && it->second == guild)
+                {
+                    m_guilds.erase(it);
+                }
+                if (!m_loader)
+                {
+                    m_dropped.insert(guild_id);
+                }
+            }
+
+            // Release the queries waiting on the placeholder; they report the rankings as unavailable
+            {
+                std::lock_guard<std::mutex> lock(guild->mutex);
+                guild->loading = false;
+                guild->evicted = true;
+                guild->failed = true;
+                guild->pending.clear();
+            }
+            guild->loaded.notify_all();
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(guild->mutex);
+            guild->boards = std::move(boards);
+            for (const auto &pending : guild->pending)
+            {
+                Board(guild->boards, pending.metric).Add(pending.player_id, pending.delta);
+            }
+            guild->pending.clear();
+            guild->pending.shrink_to_fit();
+            guild->loading = false;
+        }
+        guild->loaded.notify_all();
+    }
+
+    bool LeaderboardIndex::Read(uint64_t guild_id, const std::function<void(const GuildRankings &)> &read)
+    {
+        bool available = true;
+        while (std::shared_ptr<GuildRankings> guild = Acquire(guild_id, false, available))
+        {
+            std::unique_lock<std::mutex> lock(guild->mutex);
+            guild->loaded.wait(lock, [&guild] { return !guild->loading; });
+            if (guild->failed)
+            {
+                return false;
+            }
+            if (guild->evicted)
+            {
+                continue;
+            }
+
+            read(*guild);
+            return true;
+        }
+        return available;
+    }
+
+    void LeaderboardIndex::EvictLocked(std::chrono::steady_clock::time_point now)
+    {
+        m_lastSweep = now;
+
+        // Idle guilds first, then least recently used ones down to 90% of the limit (so the sort is amortized)
+        std::vector<std::pair<std::chrono::steady_clock::time_point, uint64_t>> evict;
+        std::vector<std::pair<std::chrono::steady_clock::time_point, uint64_t>> active;
+        for (const auto &guild : m_guilds)
+        {
+            if (now - guild.second->last_used > m_idleTimeout)
+            {
+                evict.emplace_back(guild.second->last_used, guild.first);
+            }
+            else
+            {
+                active.emplace_back(guild.second->last_used, guild.first);
+            }
+        }
+        if (active.size() > m_maxResidentGuilds)
+        {
+            const size_t keep = m_maxResidentGuilds - m_maxResidentGuilds / 10;
+            std::sort(active.begin(), active.end());
+            evict.insert(evict.end(), active.begin(), active.end() - keep);
+        }
+
+        for (const auto &candidate : evict)
+        {
+            auto it = m_guilds.find(candidate.second);
+            const std::shared_ptr<GuildRankings> guild = it->second;
+            {
+                // Marking the instance evicted under its own mutex makes concurrent users acquire the guild again,
+                // so no delta lands on an orphaned instance. Placeholders stay until their load completes.
+                std::lock_guard<std::mutex> lock(guild->mutex);
+                if (guild->loading)
+                {
+                    continue;
+                }
+                guild->evicted = true;
+
+                // Without a loader, keep the scores as a compact record list instead of trees and hash maps
+                if (!m_loader)
+                {
+                    FrozenGuild frozen;
+                    frozen.frozen_at = now;
+                    for (size_t metric = 0; metric < guild->boards.size(); ++metric)
+                    {
+                        guild->boards[metric].for_each(
+                            [&](const RankingEntry &entry)
+                            {
+                                frozen.records.push_back(RankingRecord{candidate.second, entry.player_id,
+                                                                       static_cast<RankingMetric>(metric),
+                                                                       entry.score});
+                            });
+                    }
+                    if (!frozen.records.empty())
+                    {
+                        frozen.records.shrink_to_fit();
+                        m_frozenRecords += frozen.records.size();
+                        m_frozen[candidate.second] = std::move(frozen);
+                    }
+                }
+            }
+
+            m_guilds.erase(it);
+        }
+
+        TrimFrozenLocked();
+    }
+
+    void LeaderboardIndex::TrimFrozenLocked()
+    {
+        if (m_frozenRecords <= m_maxFrozenRecords)
+        {
+            return;
+        }
+
+        // Drop down to 90% of the limit so the sort is amortized over many evictions
+        std::vector<std::pair<std::chrono::steady_clock::time_point, uint64_t>> oldest;
+        oldest.reserve(m_frozen.size());
+        for (const auto &frozen : m_frozen)
+        {
+            oldest.emplace_back(frozen.second.frozen_at, frozen.first);
+        }
+        std::sort(oldest.begin(), oldest.end());
+
+        const size_t target = m_maxFrozenRecords - m_maxFrozenRecords / 10;
+        size_t dropped = 0;
+        for (const auto &candidate : oldest)
+        {
+            if (m_frozenRecords <= target)
+            {
+                break;
+            }
+            auto it = m_frozen.find(candidate.second);
+            m_frozenRecords -= it->second.records.size();
+            m_frozen.erase(it);
+            m_dropped.insert(candidate.second);
+            ++dropped;
+        }
+
+        std::cerr << "Leaderboard index over its frozen record limit, dropped the rankings of " << dropped
+                  << " idle guilds until the next rebuild." << std::endl;
+    }
+
+    std::string RenderLeaderboard(LeaderboardIndex &index, uint64_t guild_id, RankingMetric metric, bool global,
+                                  uint64_t user_id, size_t k)
+    {
+        std::ostringstream content;
+        content << "**" << RankingMetricName(metric) << " Leaderboard (" << (global ? "Global" : "Server") << ")**\n";
+
+        std::vector<RankingEntry> top;
+        std::optional<size_t> rank;
+        if (global)
+        {
+            top = index.GlobalTopK(metric, k);
+            rank = index.GlobalRankOf(metric, user_id);
+        }
+        else if (!index.TopK(guild_id, metric, k, top) || !index.RankOf(guild_id, metric, user_id, rank))
+        {
+            content << "The rankings of this server are unavailable right now, please try again later.";
+            return content.str();
+        }
+        if (top.empty())
+        {
+            content << "Nobody has been ranked yet.\n";
+        }
+        for (size_t i = 0; i < top.size(); ++i)
+        {
+            content << (i + 1) << ". <@" << top[i].player_id << "> - " << top[i].score << "\n";
+        }
+
+        if (rank)
+        {
+            content << "Your rank: #" << *rank;
+        }
+        else
+        {
+            content << "You are not ranked yet.";
+        }
+        return content.str();
+    }
+} // namespace Core::Ranking
\ No newline at end of file
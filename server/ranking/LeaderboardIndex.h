@@ -0,0 +1,258 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "server/ranking/OrderStatisticTree.h"
+
+namespace Core::Ranking
+{
+    /// @brief Defines the quantities players can be ranked by.
+    enum class RankingMetric
+    {
+        COLLECTION_VALUE,  ///< Total value of the cards a player owns.
+        RARITY_SCORE,      ///< Rarity-weighted count of the cards a player owns.
+        GAMBLING_WINNINGS, ///< Net currency won through gambling.
+        COUNT              ///< Number of metrics (not a metric).
+    };
+
+    /// @brief Parses a metric name as used by the leaderboard command ("value", "rarity", "gambling").
+    /// @param name The metric name.
+    /// @return The metric, or std::nullopt if the name is unknown.
+    std::optional<RankingMetric> ParseRankingMetric(std::string_view name);
+
+    /// @brief Gets the display name of a metric.
+    std::string RankingMetricName(RankingMetric metric);
+
+    /// @brief A persisted score, as loaded from the database.
+    struct RankingRecord
+    {
+        uint64_t guild_id = 0;                                  ///< @brief The guild the score belongs to.
+        uint64_t player_id = 0;                                 ///< @brief The Discord ID of the player.
+        RankingMetric metric = RankingMetric::COLLECTION_VALUE; ///< @brief The metric the score is for.
+        int64_t score = 0;                                      ///< @brief The score.
+    };
+
+    /// @brief Ranking of all players for a single metric.
+    /// @details Keeps the player's current score next to the tree so a score change can find and move its entry.
+    class Scoreboard
+    {
+    public:
+        /// @brief Adds a delta to a player's score (players start at 0).
+        void Add(uint64_t player_id, int64_t delta);
+
+        /// @brief Gets the 1-based rank of a player.
+        /// @return The rank, or std::nullopt if the player has no score.
+        std::optional<size_t> RankOf(uint64_t player_id) const;
+
+        /// @brief Gets the score of a player (0 if the player has no score).
+        int64_t ScoreOf(uint64_t player_id) const;
+
+        /// @brief Gets the best k entries, best first.
+        std::vector<RankingEntry> Top(size_t k) const { return m_tree.Top(k); }
+
+        /// @brief Gets the number of ranked players.
+        size_t size() const { return m_tree.size(); }
+
+        /// @brief Calls 'func(RankingEntry)' for every ranked player.
+        template <typename Func> void for_each(Func &&func) const
+        {
+            for (const auto &score : m_scores)
+            {
+                func(RankingEntry{score.first, score.second});
+            }
+        }
+
+    private:
+        OrderStatisticTree m_tree;                      ///< @brief Players ordered by score.
+        std::unordered_map<uint64_t, int64_t> m_scores; ///< @brief Current score per player.
+    };
+
+    /// @brief In-memory rankings per guild and across all guilds, updated incrementally.
+    /// @details Inventory and balance mutations report their effect through ApplyDelta() after being written to the
+    /// database; top-K and rank queries are then answered from the index in O(log n) (plus O(k) for the result).
+    ///
+    /// The global rankings are always resident. Guild rankings are only kept in memory while in use: guilds idle for
+    /// longer than the idle timeout (or beyond the resident guild limit, least recently used first) are evicted and
+    /// reloaded on their next query. With a guild loader the evicted rankings are simply dropped and reloaded from
+    /// the database. Without one they are frozen into a compact record list; the frozen lists are capped at a total
+    /// record count, past which the least recently frozen guilds are dropped. A dropped guild is remembered and its
+    /// rankings are reported as unavailable (rather than rebuilt from later deltas alone) until the next Rebuild().
+    /// Guilds without any score are never kept.
+    ///
+    /// Loading a guild (from the loader or a frozen list) happens outside the index-wide lock. While it is in
+    /// flight the guild is represented by a placeholder: queries wait for it, and deltas are queued on it and
+    /// replayed on top of the loaded scores. If the load fails, the queries waiting on it report the rankings as
+    /// unavailable and the queued deltas are dropped: with a loader the database already holds them and the next
+    /// access loads again, without one the guild is dropped like a trimmed frozen guild.
+    ///
+    /// All methods are thread-safe.
+    class LeaderboardIndex
+    {
+    public:
+        /// @brief Loads the persisted scores of one guild.
+        using GuildLoader = std::function<std::vector<RankingRecord>(uint64_t guild_id)>;
+
+        /// @brief Constructs an empty index.
+        /// @param max_resident_guilds The maximum number of guilds whose rankings are kept in memory.
+        /// @param idle_timeout Guilds not used for this long are evicted.
+        /// @param loader Loads a guild's scores from the database (may be null, see class description).
+        /// @param max_frozen_records The maximum number of records kept for evicted guilds when there is no loader.
+        LeaderboardIndex(size_t max_resident_guilds = 1000,
+                         std::chrono::steady_clock::duration idle_timeout = std::chrono::minutes(30),
+                         GuildLoader loader = nullptr, size_t max_frozen_records = 1'000'000);
+
+        /// @brief Replaces the contents of the index with the given records (e.g. at startup).
+        /// @details Global scores are the sum of a player's scores over all guilds.
+        /// @param records Every persisted score.
+        void Rebuild(const std::vector<RankingRecord> &records);
+
+        /// @brief Applies a change of a player's score in a guild (and globally).
+        /// @details Must be called after the mutation has been written to the database. Guilds that are not resident
+        /// are skipped when a loader is set, since their next load reads the mutation back from the database. Deltas
+        /// arriving while a guild is being loaded are replayed after the load, so the loader must not return
+        /// mutations committed after it was called (read from a snapshot taken before the query).
+        /// @param guild_id The guild where the mutation happened.
+        /// @param player_id The Discord ID of the player.
+        /// @param metric The metric that changed.
+        /// @param delta The change in score.
+        void ApplyDelta(uint64_t guild_id, uint64_t player_id, RankingMetric metric, int64_t delta);
+
+        /// @brief Gets the best players of a guild.
+        /// @param[out] top Up to k entries, best first (empty if the guild has no scores).
+        /// @return false if the guild's rankings are unavailable (see class description).
+        bool TopK(uint64_t guild_id, RankingMetric metric, size_t k, std::vector<RankingEntry> &top);
+
+        /// @brief Gets the 1-based rank of a player within a guild.
+        /// @param[out] rank The rank, or std::nullopt if the player has no score in the guild.
+        /// @return false if the guild's rankings are unavailable (see class description).
+        bool RankOf(uint64_t guild_id, RankingMetric metric, uint64_t player_id, std::optional<size_t> &rank);
+
+        /// @brief Gets the best players across all guilds.
+        /// @return Up to k entries, best first.
+        std::vector<RankingEntry> GlobalTopK(RankingMetric metric, size_t k) const;
+
+        /// @brief Gets the 1-based rank of a player across all guilds.
+        /// @return The rank, or std::nullopt if the player has no score.
+        std::optional<size_t> GlobalRankOf(RankingMetric metric, uint64_t player_id) const;
+
+        /// @brief Gets the number of guilds whose rankings are currently in memory.
+        size_t ResidentGuilds() const;
+
+    private:
+        /// @brief Boards for every metric.
+        using Boards = std::array<Scoreboard, static_cast<size_t>(RankingMetric::COUNT)>;
+
+        /// @brief A delta queued while its guild is being loaded.
+        struct PendingDelta
+        {
+            uint64_t player_id;   ///< @brief The Discord ID of the player.
+            RankingMetric metric; ///< @brief The metric that changed.
+            int64_t delta;        ///< @brief The change in score.
+        };
+
+        /// @brief The rankings of a single guild.
+        struct GuildRankings
+        {
+            /// @brief One board per metric.
+            Boards boards;
+            /// @brief Last query or update (protected by m_guildsMutex rather than 'mutex').
+            std::chrono::steady_clock::time_point last_used;
+            /// @brief Whether this is a placeholder whose scores are still being loaded.
+            bool loading = false;
+            /// @brief Whether this instance was evicted; users holding it must acquire the guild again.
+            bool evicted = false;
+            /// @brief Whether loading this placeholder failed (it is also marked evicted).
+            bool failed = false;
+            /// @brief Deltas to replay once loading completes.
+            std::vector<PendingDelta> pending;
+            /// @brief Signalled when loading completes.
+            std::condition_variable loaded;
+            /// @brief Protects all fields but last_used.
+            mutable std::mutex mutex;
+        };
+
+        /// @brief The scores of an evicted guild (only used without a loader).
+        struct FrozenGuild
+        {
+            std::vector<RankingRecord> records;              ///< @brief The guild's scores.
+            std::chrono::steady_clock::time_point frozen_at; ///< @brief When the guild was evicted.
+        };
+
+        /// @brief Gets the resident rankings of a guild, starting a load if needed.
+        /// @details The returned instance may still be loading, or may have been evicted by the time the caller
+        /// locks it; callers check both under the guild's mutex.
+        /// @param guild_id The guild to look up.
+        /// @param for_update Whether the caller is applying a delta (rather than querying).
+        /// @param[out] available Set to false if the guild's rankings were dropped (null is returned).
+        /// @return The rankings, or null if the guild has no scores to load (queries), is not resident and the
+        /// database already holds the delta (updates with a loader), or was dropped.
+        std::shared_ptr<GuildRankings> Acquire(uint64_t guild_id, bool for_update, bool &available);
+
+        /// @brief Loads the scores of a placeholder, replays the queued deltas and wakes up waiting queries.
+        /// @details Never throws; a failed load is logged and marks the placeholder as failed.
+        /// @param guild_id The guild being loaded.
+        /// @param guild The placeholder.
+        /// @param records The frozen records to build from, or null to call the loader.
+        void Load(uint64_t guild_id, const std::shared_ptr<GuildRankings> &guild, std::vector<RankingRecord> *records);
+
+        /// @brief Runs 'read' on the fully loaded rankings of a guild.
+        /// @details 'read' is not called if the guild has no scores.
+        /// @return false if the guild's rankings are unavailable.
+        bool Read(uint64_t guild_id, const std::function<void(const GuildRankings &)> &read);
+
+        /// @brief Evicts idle guilds, then least recently used guilds while over the resident limit.
+        /// @details Must be called with m_guildsMutex held.
+        void EvictLocked(std::chrono::steady_clock::time_point now);
+
+        /// @brief Drops the least recently frozen guilds while over the frozen record limit (see m_dropped).
+        /// @details Must be called with m_guildsMutex held.
+        void TrimFrozenLocked();
+
+        /// @brief Gets the board of a metric.
+        static Scoreboard &Board(Boards &boards, RankingMetric metric) { return boards[static_cast<size_t>(metric)]; }
+
+        /// @brief Gets the board of a metric.
+        static const Scoreboard &Board(const Boards &boards, RankingMetric metric)
+        {
+            return boards[static_cast<size_t>(metric)];
+        }
+
+    private:
+        size_t m_maxResidentGuilds;                        ///< @brief The maximum number of resident guilds.
+        std::chrono::steady_clock::duration m_idleTimeout; ///< @brief Guilds idle for longer are evicted.
+        GuildLoader m_loader;                              ///< @brief Loads guild scores from the database.
+        size_t m_maxFrozenRecords;                         ///< @brief The maximum number of frozen records.
+
+        std::unordered_map<uint64_t, std::shared_ptr<GuildRankings>> m_guilds; ///< @brief Resident guilds.
+        std::unordered_map<uint64_t, FrozenGuild> m_frozen; ///< @brief Evicted guilds (no loader).
+        size_t m_frozenRecords = 0;                         ///< @brief Total number of records in m_frozen.
+        std::unordered_set<uint64_t> m_dropped;             ///< @brief Guilds dropped from m_frozen since Rebuild().
+        std::chrono::steady_clock::time_point m_lastSweep;  ///< @brief Last time idle guilds were evicted.
+        mutable std::mutex m_guildsMutex; ///< @brief Protects all of the above but the settings.
+
+        GuildRankings m_global; ///< @brief Rankings across all guilds (always resident).
+    };
+
+    /// @brief Renders a leaderboard as a Discord message.
+    /// @param index The index to query.
+    /// @param guild_id The guild the command was used in (ignored for global leaderboards).
+    /// @param metric The metric to rank by.
+    /// @param global Whether to rank across all guilds.
+    /// @param user_id The player requesting the leaderboard (their rank is appended).
+    /// @param k The number of entries to show.
+    /// @return The message content.
+    std::string RenderLeaderboard(LeaderboardIndex &index, uint64_t guild_id, RankingMetric metric, bool global,
+                                  uint64_t user_id, size_t k);
+} // namespace Core::Ranking
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "server/ranking/OrderStatisticTree.h"
+
+namespace Core::Ranking
+{
+    OrderStatisticTree::OrderStatisticTree() { m_nodes.emplace_back(); }
+
+    void OrderStatisticTree::Insert(const RankingEntry &entry)
+    {
+        uint32_t left, right;
+        Split(m_root, entry, left, right);
+        m_root = Merge(Merge(left, NewNode(entry)), right);
+    }
+
+    bool OrderStatisticTree::Erase(const RankingEntry &entry)
+    {
+        uint32_t left, rest, middle, right;
+        Split(m_root, entry, left, rest);
+        SplitFirst(rest, 1, middle, right);
+
+        // The first entry not ordered before 'entry' is 'entry' itself if it is present
+        const bool found = middle != 0 && m_nodes[middle].entry.player_id == entry.player_id &&
+                           m_nodes[middle].entry.score == entry.score;
+        if (found)
+        {
+            m_free.push_back(middle);
+            middle = 0;
+        }
+
+        m_root = Merge(Merge(left, middle), right);
+        return found;
+    }
+
+    size_t OrderStatisticTree::RankOf(const RankingEntry &entry) const
+    {
+        size_t rank = 0;
+        uint32_t node = m_root;
+        while (node != 0)
+        {
+            if (Before(m_nodes[node].entry, entry))
+            {
+                rank += m_nodes[m_nodes[node].left].size + 1;
+                node = m_nodes[node].right;
+            }
+            else
+            {
+                node = m_nodes[node].left;
+            }
+        }
+        return rank;
+    }
+
+    RankingEntry OrderStatisticTree::At(size_t rank) const
+    {
+        uint32_t node = m_root;
+        while (node != 0)
+        {
+            const size_t leftSize = m_nodes[m_nodes[node].left].size;
+            if (rank < leftSize)
+            {
+                node = m_nodes[node].left;
+            }
+            else if (rank == leftSize)
+            {
+                return m_nodes[node].entry;
+            }
+            else
+            {
+                rank -= leftSize + 1;
+                node = m_nodes[node].right;
+            }
+        }
+        return RankingEntry();
+    }
+
+    std::vector<RankingEntry> OrderStatisticTree::Top(size_t k) const
+    {
+        std::vector<RankingEntry> result;
+        result.reserve(k < size() ? k : size());
+
+        // Iterative in-order traversal, stopping after k entries
+        std::vector<uint32_t> stack;
+        uint32_t node = m_root;
+        while (result.size() < k && (node != 0 || !stack.empty()))
+        {
+            while (node != 0)
+            {
+                stack.push_back(node);
+                node = m_nodes[node].left;
+            }
+            node = stack.back();
+            stack.pop_back();
+            result.push_back(m_nodes[node].entry);
+            node = m_nodes[node].right;
+        }
+        return result;
+    }
+
+    void OrderStatisticTree::clear()
+    {
+        m_nodes.clear();
+        m_nodes.shrink_to_fit();
+        m_free.clear();
+        m_free.shrink_to_fit();
+        m_nodes.emplace_back();
+        m_root = 0;
+    }
+
+    void OrderStatisticTree::Split(uint32_t node, const RankingEntry &key, uint32_t &left, uint32_t &right)
+    {
+        if (node == 0)
+        {
+            left = right = 0;
+            return;
+        }
+
+        if (Before(m_nodes[node].entry, key))
+        {
+            Split(m_nodes[node].right, key, m_nodes[node].right, right);
+            left = node;
+        }
+        else
+        {
+            Split(m_nodes[node].left, key, left, m_nodes[node].left);
+            right = node;
+        }
+        Update(node);
+    }
+
+    void OrderStatisticTree::SplitFirst(uint32_t node, size_t count, uint32_t &left, uint32_t &right)
+    {
+        if (node == 0)
+        {
+            left = right = 0;
+            return;
+        }
+
+        const size_t leftSize = m_nodes[m_nodes[node].left].size;
+        if (leftSize < count)
+        {
+            SplitFirst(m_nodes[node].right, count - leftSize - 1, m_nodes[node].right, right);
+            left = node;
+        }
+        else
+        {
+            SplitFirst(m_nodes[node].left, count, left, m_nodes[node].left);
+            right = node;
+        }
+        Update(node);
+    }
+
+    uint32_t OrderStatisticTree::Merge(uint32_t left, uint32_t right)
+    {
+        if (left == 0 || right == 0)
+        {
+            return left != 0 ? left : right;
+        }
+
+        if (m_nodes[left].priority > m_nodes[right].priority)
+        {
+            m_nodes[left].right = Merge(m_nodes[left].right, right);
+            Update(left);
+            return left;
+        }
+
+        m_nodes[right].left = Merge(left, m_nodes[right].left);
+        Update(right);
+        return right;
+    }
+
+    uint32_t OrderStatisticTree::NewNode(const RankingEntry &entry)
+    {
+        uint32_t node;
+        if (!m_free.empty())
+        {
+            node = m_free.back();
+            m_free.pop_back();
+        }
+        else
+        {
+            node = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        m_nodes[node].entry = entry;
+        m_nodes[node].priority = NextPriority();
+        m_nodes[node].left = 0;
+        m_nodes[node].right = 0;
+        m_nodes[node].size = 1;
+        return node;
+    }
+
+    uint32_t OrderStatisticTree::NextPriority()
+    {
+        m_rngState ^= m_rngState << 13;
+        m_rngState ^= m_rngState >> 17;
+        m_rngState ^= m_rngState << 5;
+        return m_rngState;
+    }
+} // namespace Core::Ranking
\ No newline at end of file
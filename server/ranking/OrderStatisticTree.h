@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Core::Ranking
+{
+    /// @brief A player's score within a ranking.
+    struct RankingEntry
+    {
+        uint64_t player_id = 0; ///< @brief The Discord ID of the player.
+        int64_t score = 0;      ///< @brief The player's score.
+    };
+
+    /// @brief Ordered set of ranking entries supporting rank and select queries in O(log n).
+    /// @details Implemented as a size-augmented treap. Entries are ordered by descending score, ties broken by
+    /// ascending player ID, so every entry has a distinct rank. Nodes are pooled in a single vector and addressed by
+    /// index, which keeps the tree compact and lets clear() release everything at once.
+    class OrderStatisticTree
+    {
+    public:
+        /// @brief Constructs an empty tree.
+        OrderStatisticTree();
+
+        /// @brief Inserts an entry. The (player, score) pair must not already be present.
+        /// @param entry The entry to insert.
+        void Insert(const RankingEntry &entry);
+
+        /// @brief Removes an entry.
+        /// @param entry The entry to remove.
+        /// @return true if the entry was present and removed, false otherwise.
+        bool Erase(const RankingEntry &entry);
+
+        /// @brief Gets the number of entries ordered before the given one (its 0-based rank).
+        /// @param entry The entry to look up (does not need to be present).
+        /// @return The number of entries ordered strictly before the entry.
+        size_t RankOf(const RankingEntry &entry) const;
+
+        /// @brief Gets the entry at a given 0-based rank.
+        /// @param rank The rank to look up; must be less than size().
+        /// @return The entry at that rank.
+        RankingEntry At(size_t rank) const;
+
+        /// @brief Gets the first entries in rank order.
+        /// @param k The maximum number of entries to return.
+        /// @return Up to k entries, best first. Runs in O(k + log n).
+        std::vector<RankingEntry> Top(size_t k) const;
+
+        /// @brief Gets the number of entries in the tree.
+        size_t size() const { return m_nodes[m_root].size; }
+
+        /// @brief Removes all entries and releases the node pool.
+        void clear();
+
+    private:
+        /// @brief A tree node; index 0 is a sentinel standing in for "no node".
+        struct Node
+        {
+            RankingEntry entry;    ///< @brief The entry stored in this node.
+            uint32_t priority = 0; ///< @brief Random heap priority keeping the tree balanced.
+            uint32_t left = 0;     ///< @brief Index of the left child (0 if none).
+            uint32_t right = 0;    ///< @brief Index of the right child (0 if none).
+            uint32_t size = 0;     ///< @brief Number of nodes in this subtree.
+        };
+
+        /// @brief Checks whether entry 'a' is ordered before entry 'b'.
+        static bool Before(const RankingEntry &a, const RankingEntry &b)
+        {
+            return a.score > b.score || (a.score == b.score && a.player_id < b.player_id);
+        }
+
+        /// @brief Splits a subtree into the entries ordered before 'key' and the rest.
+        void Split(uint32_t node, const RankingEntry &key, uint32_t &left, uint32_t &right);
+
+        /// @brief Splits off the first 'count' entries of a subtree.
+        void SplitFirst(uint32_t node, size_t count, uint32_t &left, uint32_t &right);
+
+        /// @brief Joins two subtrees where every entry of 'left' is ordered before every entry of 'right'.
+        uint32_t Merge(uint32_t left, uint32_t right);
+
+        /// @brief Recomputes the size of a node from its children.
+        void Update(uint32_t node)
+        {
+            m_nodes[node].size = 1 + m_nodes[m_nodes[node].left].size + m_nodes[m_nodes[node].right].size;
+        }
+
+        /// @brief Allocates a node from the pool.
+        uint32_t NewNode(const RankingEntry &entry);
+
+        /// @brief Generates the next random priority (xorshift32).
+        uint32_t NextPriority();
+
+    private:
+        std::vector<Node> m_nodes;         ///< @brief Node pool; index 0 is the sentinel.
+        std::vector<uint32_t> m_free;      ///< @brief Indices of released nodes available for reuse.
+        uint32_t m_root = 0;               ///< @brief Index of the root node (0 if empty).
+        uint32_t m_rngState = 2463534242U; ///< @brief State of the priority generator.
+    };
+} // namespace Core::Ranking
\ No newline at end of file